@@ -1,6 +1,4 @@
 /*
- * Uses the median filter algorithm from N. Wirth’s book, implementation by N. Devillard.
- *
  * @author Ryan Benasutti, WPI
  *
  * This Source Code Form is subject to the terms of the Mozilla Public
@@ -10,7 +8,6 @@
 #pragma once
 
 #include "okapi/api/filter/filter.hpp"
-#include <algorithm>
 #include <array>
 #include <cstddef>
 
@@ -18,11 +15,28 @@ namespace okapi {
 /**
  * A filter which returns the median value of list of values.
  *
+ * The window is kept split across two heaps: a max-heap holding the smallest middleIndex + 1
+ * values and a min-heap holding the rest, so the median is always the top of the max-heap. A new
+ * reading replaces the oldest one in place and is sifted back into order, which is O(log n) per
+ * sample instead of copying and partially sorting the whole window. For an even number of taps
+ * the lower of the two middle values is returned.
+ *
  * @tparam n number of taps in the filter
  */
 template <std::size_t n> class MedianFilter : public Filter {
+  static_assert(n > 0, "MedianFilter needs at least one tap");
+
   public:
   MedianFilter() : middleIndex((((n)&1) ? ((n) / 2) : (((n) / 2) - 1))) {
+    // The window starts out all zeros, so any split is already in order
+    for (std::size_t i = 0; i < lowSize; i++) {
+      low[i] = i;
+      position[i] = i;
+    }
+    for (std::size_t i = 0; i < highSize; i++) {
+      high[i] = lowSize + i;
+      position[lowSize + i] = lowSize + i;
+    }
   }
 
   /**
@@ -32,12 +46,32 @@ template <std::size_t n> class MedianFilter : public Filter {
    * @return filtered result
    */
   double filter(const double ireading) override {
-    data[index++] = ireading;
+    const std::size_t slot = index++;
     if (index >= n) {
       index = 0;
     }
 
-    output = kth_smallset();
+    data[slot] = ireading;
+    if (position[slot] < lowSize) {
+      siftUpLow(position[slot]);
+      siftDownLow(position[slot]);
+    } else {
+      siftUpHigh(position[slot] - lowSize);
+      siftDownHigh(position[slot] - lowSize);
+    }
+
+    // Only the changed value can be on the wrong side, one exchange of the tops fixes it
+    if (highSize > 0 && data[high[0]] < data[low[0]]) {
+      const std::size_t t = low[0];
+      low[0] = high[0];
+      high[0] = t;
+      position[low[0]] = 0;
+      position[high[0]] = lowSize;
+      siftDownLow(0);
+      siftDownHigh(0);
+    }
+
+    output = data[low[0]];
     return output;
   }
 
@@ -56,41 +90,81 @@ template <std::size_t n> class MedianFilter : public Filter {
   double output = 0;
   const size_t middleIndex;
 
-  /**
-   * Algorithm from N. Wirth’s book, implementation by N. Devillard.
-   */
-  double kth_smallset() {
-    std::array<double, n> dataCopy = data;
-    size_t j, l, m;
-    l = 0;
-    m = n - 1;
-
-    while (l < m) {
-      double x = dataCopy[middleIndex];
-      size_t i = l;
-      j = m;
-      do {
-        while (dataCopy[i] < x) {
-          i++;
-        }
-        while (x < dataCopy[j]) {
-          j--;
-        }
-        if (i <= j) {
-          const double t = dataCopy[i];
-          dataCopy[i] = dataCopy[j];
-          dataCopy[j] = t;
-          i++;
-          j--;
-        }
-      } while (i <= j);
-      if (j < middleIndex)
-        l = i;
-      if (middleIndex < i)
-        m = j;
+  static constexpr std::size_t lowSize = ((n)&1) ? ((n) / 2) + 1 : (n) / 2;
+  static constexpr std::size_t highSize = n - lowSize;
+
+  // Slots of data, low is a max-heap of the smaller half and high a min-heap of the larger half
+  std::array<std::size_t, lowSize> low{};
+  std::array<std::size_t, highSize> high{};
+  // Where each slot of data sits: [0, lowSize) in low, [lowSize, n) at that minus lowSize in high
+  std::array<std::size_t, n> position{};
+
+  void swapLow(const std::size_t i, const std::size_t j) {
+    const std::size_t t = low[i];
+    low[i] = low[j];
+    low[j] = t;
+    position[low[i]] = i;
+    position[low[j]] = j;
+  }
+
+  void swapHigh(const std::size_t i, const std::size_t j) {
+    const std::size_t t = high[i];
+    high[i] = high[j];
+    high[j] = t;
+    position[high[i]] = lowSize + i;
+    position[high[j]] = lowSize + j;
+  }
+
+  void siftUpLow(std::size_t i) {
+    while (i > 0 && data[low[(i - 1) / 2]] < data[low[i]]) {
+      swapLow(i, (i - 1) / 2);
+      i = (i - 1) / 2;
+    }
+  }
+
+  void siftDownLow(std::size_t i) {
+    while (true) {
+      std::size_t largest = i;
+      const std::size_t left = 2 * i + 1;
+      const std::size_t right = left + 1;
+      if (left < lowSize && data[low[largest]] < data[low[left]]) {
+        largest = left;
+      }
+      if (right < lowSize && data[low[largest]] < data[low[right]]) {
+        largest = right;
+      }
+      if (largest == i) {
+        return;
+      }
+      swapLow(i, largest);
+      i = largest;
+    }
+  }
+
+  void siftUpHigh(std::size_t i) {
+    while (i > 0 && data[high[i]] < data[high[(i - 1) / 2]]) {
+      swapHigh(i, (i - 1) / 2);
+      i = (i - 1) / 2;
     }
+  }
 
-    return dataCopy[middleIndex];
+  void siftDownHigh(std::size_t i) {
+    while (true) {
+      std::size_t smallest = i;
+      const std::size_t left = 2 * i + 1;
+      const std::size_t right = left + 1;
+      if (left < highSize && data[high[left]] < data[high[smallest]]) {
+        smallest = left;
+      }
+      if (right < highSize && data[high[right]] < data[high[smallest]]) {
+        smallest = right;
+      }
+      if (smallest == i) {
+        return;
+      }
+      swapHigh(i, smallest);
+      i = smallest;
+    }
   }
 };
 } // namespace okapi
@@ -0,0 +1,68 @@
+//turns a Robot::blackbox match log into csv for a spreadsheet or pandas
+//
+//  bbdecode <bbNNN.bin> [output.csv]    write csv to output (default stdout)
+//
+//one row per control tick. a log cut off mid record by a brownout decodes up
+//to the last whole record
+
+#include "../src/blackbox.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace{
+
+const char *mode(std::uint8_t status){
+    if(status & COMPETITION_DISABLED){
+        return "disabled";
+    }
+    return (status & COMPETITION_AUTONOMOUS) ? "auton" : "driver";
+}
+
+}
+
+int main(int argc, char **argv){
+    if(argc < 2 || argc > 3){
+        std::fprintf(stderr, "usage: bbdecode <bbNNN.bin> [output.csv]\n");
+        return 2;
+    }
+    FILE *in = std::fopen(argv[1], "rb");
+    if(in == nullptr){
+        std::perror(argv[1]);
+        return 1;
+    }
+
+    BlackBoxFileHeader header;
+    if(std::fread(&header, sizeof(header), 1, in) != 1 || std::memcmp(header.magic, "BBOX", 4) != 0){
+        std::fprintf(stderr, "%s: not a blackbox log\n", argv[1]);
+        return 1;
+    }
+    if(header.version != BLACKBOX_VERSION || header.recordSize != sizeof(BlackBoxRecord)){
+        std::fprintf(stderr, "%s: log version %d with %d byte records, this decoder reads version %d with %d\n",
+                     argv[1], header.version, header.recordSize, BLACKBOX_VERSION, (int)sizeof(BlackBoxRecord));
+        return 1;
+    }
+
+    FILE *out = argc == 3 ? std::fopen(argv[2], "w") : stdout;
+    if(out == nullptr){
+        std::perror(argv[2]);
+        return 1;
+    }
+    std::fprintf(out, "time,mode,left_x,left_y,right_x,right_y,left_mv,right_mv,left_ft,right_ft,rotation,"
+                      "temp_l1,temp_r1,temp_l2,temp_r2,temp_intake_l,temp_intake_r,temp_roller1,temp_roller2\n");
+
+    BlackBoxRecord r;
+    long count = 0;
+    while(std::fread(&r, sizeof(r), 1, in) == 1){
+        std::fprintf(out, "%u,%s,%d,%d,%d,%d,%d,%d,%.4f,%.4f,%.2f", (unsigned)r.time, mode(r.status),
+                     r.axes[0], r.axes[1], r.axes[2], r.axes[3], r.leftVoltage, r.rightVoltage,
+                     r.leftPosition, r.rightPosition, r.rotation);
+        for(int i = 0; i < 8; i++){
+            std::fprintf(out, ",%d", r.temperature[i]);
+        }
+        std::fprintf(out, "\n");
+        count++;
+    }
+    std::fprintf(stderr, "%ld records, started %u ms after boot\n", count, (unsigned)header.startTime);
+    return 0;
+}
@@ -0,0 +1,57 @@
+//micro-benchmark of the joystick curve: the old trim/scale/pow path that
+//Robot::cubifySpeed used against the responsecurve.hpp table lookup
+//
+//  curvebench [iterations]
+//
+//host numbers only show the ratio, the cortex-a9 has no fast pow either
+
+#include "../src/utility.hpp"
+#include "../src/responsecurve.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace{
+
+//Robot::cubifySpeed before the table
+int powCubify(int val){
+    return scale(pow(scale(trim(val, -128, 128), -128, 128, -1, 1), 3), -1, 1, -128, 128);
+}
+
+template <typename F>
+double nanosPerCall(F curve, long iterations, long &sink){
+    //arcade inputs run past the stick range once turn is mixed in
+    auto start = std::chrono::steady_clock::now();
+    for(long i = 0; i < iterations; i++){
+        sink += curve((int)(i % 471) - 235);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return seconds * 1e9 / iterations;
+}
+
+}
+
+int main(int argc, char **argv){
+    long iterations = argc > 1 ? std::atol(argv[1]) : 50000000;
+
+    long sink = 0;
+    double powTime = nanosPerCall([](int v){ return powCubify(v); }, iterations, sink);
+    double tableTime = nanosPerCall([](int v){ return cubicCurve(v); }, iterations, sink);
+
+    //how far the table is from the old output over the stick range, with the
+    //table taken back to the 127 scale the pow path worked in
+    int differ = 0;
+    int worst = 0;
+    for(int v = -127; v <= 127; v++){
+        int diff = std::abs(powCubify(v) - cubicCurve(v) * 127 / MAX_VOLTAGE);
+        differ += diff != 0;
+        worst = diff > worst ? diff : worst;
+    }
+
+    std::printf("pow path:      %.2f ns/call\n", powTime);
+    std::printf("table lookup:  %.2f ns/call (%.1fx)\n", tableTime, powTime / tableTime);
+    std::printf("differences:   %d of 255 stick values, at most %d\n", differ, worst);
+    std::printf("checksum:      %ld\n", sink);
+    return 0;
+}
@@ -0,0 +1,119 @@
+//the few okapi classes the robot code uses. on the brain they come from
+//okapilib.a, which is built for arm only, so the sim carries host versions
+//that behave the same way
+
+#include "api.h"
+#include "okapi/api/control/util/settledUtil.hpp"
+#include "okapi/impl/util/timer.hpp"
+
+#include <cmath>
+
+namespace okapi{
+
+/////////////////////////////// AbstractTimer ///////////////////////////////
+
+AbstractTimer::AbstractTimer(const QTime ifirstCalled)
+    : firstCalled(ifirstCalled), lastCalled(ifirstCalled), mark(ifirstCalled){}
+
+AbstractTimer::~AbstractTimer() = default;
+
+QTime AbstractTimer::getDt(){
+    const QTime currTime = millis();
+    const QTime dt = currTime - lastCalled;
+    lastCalled = currTime;
+    return dt;
+}
+
+QTime AbstractTimer::readDt() const{
+    return millis() - lastCalled;
+}
+
+QTime AbstractTimer::getStartingTime() const{
+    return firstCalled;
+}
+
+QTime AbstractTimer::getDtFromStart() const{
+    return millis() - firstCalled;
+}
+
+void AbstractTimer::placeMark(){
+    mark = millis();
+}
+
+QTime AbstractTimer::clearMark(){
+    const QTime old = mark;
+    mark = 0_ms;
+    return old;
+}
+
+void AbstractTimer::placeHardMark(){
+    if(hardMark == 0_ms){
+        hardMark = millis();
+    }
+}
+
+QTime AbstractTimer::clearHardMark(){
+    const QTime old = hardMark;
+    hardMark = 0_ms;
+    return old;
+}
+
+QTime AbstractTimer::getDtFromMark() const{
+    return mark == 0_ms ? 0_ms : millis() - mark;
+}
+
+QTime AbstractTimer::getDtFromHardMark() const{
+    return hardMark == 0_ms ? 0_ms : millis() - hardMark;
+}
+
+bool AbstractTimer::repeat(const QTime time){
+    if(repeatMark == 0_ms){
+        repeatMark = millis();
+        return false;
+    }
+    if(millis() - repeatMark >= time){
+        repeatMark = 0_ms;
+        return true;
+    }
+    return false;
+}
+
+bool AbstractTimer::repeat(const QFrequency frequency){
+    return repeat(QTime(1 / frequency.convert(Hz)));
+}
+
+/////////////////////////////////// Timer ///////////////////////////////////
+
+Timer::Timer() : AbstractTimer(millis()){}
+
+QTime Timer::millis() const{
+    return pros::millis() * millisecond;
+}
+
+//////////////////////////////// SettledUtil ////////////////////////////////
+
+SettledUtil::SettledUtil(std::unique_ptr<AbstractTimer> iatTargetTimer,
+                         const double iatTargetError,
+                         const double iatTargetDerivative,
+                         const QTime iatTargetTime)
+    : atTargetError(iatTargetError), atTargetDerivative(iatTargetDerivative),
+      atTargetTime(iatTargetTime), atTargetTimer(std::move(iatTargetTimer)){}
+
+SettledUtil::~SettledUtil() = default;
+
+bool SettledUtil::isSettled(const double ierror){
+    if(std::fabs(ierror) <= atTargetError && std::fabs(ierror - lastError) <= atTargetDerivative){
+        atTargetTimer->placeHardMark();
+    }else{
+        atTargetTimer->clearHardMark();
+    }
+    lastError = ierror;
+    return atTargetTimer->getDtFromHardMark() >= atTargetTime;
+}
+
+void SettledUtil::reset(){
+    atTargetTimer->clearHardMark();
+    lastError = 0;
+}
+
+}
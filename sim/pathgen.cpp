@@ -0,0 +1,78 @@
+//generates src/autonpaths.hpp, the autonomous trajectories as constexpr
+//tables, so the brain never has to build them at startup
+//
+//  pathgen [output]    write the header to output (default stdout)
+//
+//the limits here are in ft/s and have to be kept in line with Robot, the
+//header records them so a stale table is easy to spot
+
+#include "../src/trajectory.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace{
+
+struct PathSpec{
+    const char *name;
+    std::vector<PathPose> poses;
+    ProfileLimits limits;
+};
+
+//Robot::trackWidth
+const double trackWidth = 12.5 / 12;
+const double dt = 0.01;
+
+//drive(x, 30) used to run at about 30/127 of the 4.7 ft/s free speed
+const std::vector<PathSpec> paths = {
+    {"pickup", {{0, 0, 0}, {3, 0, 0}}, {1.1, 6, 30}},
+};
+
+void writeTable(FILE *out, const std::string &name, const std::vector<TrajectorySegment> &segments){
+    std::fprintf(out, "constexpr TrajectorySegment %s[] = {\n", name.c_str());
+    for(const TrajectorySegment &s : segments){
+        std::fprintf(out, "    {%g, %.6f, %.6f, %.6f, %.6f, %.6f, %.6f, %.4f},\n",
+                     s.dt, s.x, s.y, s.position, s.velocity, s.acceleration, s.jerk, s.heading);
+    }
+    std::fprintf(out, "};\n\n");
+}
+
+}
+
+int main(int argc, char **argv){
+    FILE *out = stdout;
+    if(argc > 1){
+        out = std::fopen(argv[1], "w");
+        if(out == nullptr){
+            std::perror(argv[1]);
+            return 1;
+        }
+    }
+
+    std::fprintf(out, "//generated by sim/pathgen.cpp, don't edit. rebuild with make -C sim paths\n");
+    std::fprintf(out, "#ifndef AUTONPATHS_HPP\n#define AUTONPATHS_HPP\n\n#include \"trajectory.hpp\"\n\n");
+    for(const PathSpec &path : paths){
+        std::vector<TrajectorySegment> left;
+        std::vector<TrajectorySegment> right;
+        generateTrajectory(path.poses, path.limits, trackWidth, dt, left, right);
+
+        std::string name = path.name;
+        std::fprintf(out, "//%s:", path.name);
+        for(const PathPose &pose : path.poses){
+            std::fprintf(out, " (%g, %g, %g)", pose.x, pose.y, pose.heading);
+        }
+        std::fprintf(out, "\n//%g ft/s, %g ft/s^2, track width %.4f ft, %.2f s\n",
+                     path.limits.velocity, path.limits.acceleration, trackWidth, (left.size() - 1) * dt);
+        writeTable(out, name + "Left", left);
+        writeTable(out, name + "Right", right);
+        std::fprintf(out, "constexpr Trajectory %sTrajectory = {%sLeft, %sRight, %d};\n\n",
+                     path.name, path.name, path.name, (int)left.size());
+    }
+    std::fprintf(out, "#endif\n");
+
+    if(out != stdout){
+        std::fclose(out);
+    }
+    return 0;
+}
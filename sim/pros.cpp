@@ -0,0 +1,563 @@
+//implementations of the parts of the pros api the robot code uses, backed by
+//the sim model instead of the v5 brain. everything else returns the same
+//defaults a disconnected device would
+
+#include "api.h"
+#include "pros/apix.h"
+#include "sim.hpp"
+
+#include <cerrno>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace{
+
+//storage is taken once in queue_create like the kernel does, so posting
+//never allocates
+struct SimQueue{
+    std::uint32_t length;
+    std::uint32_t itemSize;
+    std::vector<std::uint8_t> storage;
+    std::uint32_t head = 0;
+    std::uint32_t count = 0;
+};
+
+bool lcdEcho = false;
+bool usdInstalled = false;
+std::uint8_t competitionStatus = 0;
+
+double countsPerRev(int gearset){
+    return gearset == 0 ? 1800 : (gearset == 2 ? 300 : 900);
+}
+
+double gearsetRpm(int gearset){
+    return gearset == 0 ? 100 : (gearset == 2 ? 600 : 200);
+}
+
+std::int32_t command(std::uint8_t port, std::int32_t millivolts){
+    sim::Motor &m = sim::motor(port);
+    millivolts = millivolts > 12000 ? 12000 : (millivolts < -12000 ? -12000 : millivolts);
+    m.voltage = millivolts;
+    m.commands++;
+    return 1;
+}
+
+}
+
+namespace sim{
+void setLcdEcho(bool echo){
+    lcdEcho = echo;
+}
+
+void setUsdInstalled(bool installed){
+    usdInstalled = installed;
+}
+
+void setCompetitionStatus(std::uint8_t status){
+    competitionStatus = status;
+}
+}
+
+namespace pros{
+
+/////////////////////////////////// motor ///////////////////////////////////
+
+Motor::Motor(const std::uint8_t port, const motor_gearset_e_t gearset, const bool reverse,
+             const motor_encoder_units_e_t encoder_units)
+    : _port(port){
+    sim::Motor &m = sim::motor(port);
+    m.used = true;
+    m.gearset = gearset;
+    m.reversed = reverse;
+    m.encoderUnits = encoder_units;
+}
+
+Motor::Motor(const std::uint8_t port, const motor_gearset_e_t gearset, const bool reverse)
+    : Motor(port, gearset, reverse, E_MOTOR_ENCODER_DEGREES){}
+
+Motor::Motor(const std::uint8_t port, const motor_gearset_e_t gearset)
+    : Motor(port, gearset, false, E_MOTOR_ENCODER_DEGREES){}
+
+Motor::Motor(const std::uint8_t port, const bool reverse)
+    : Motor(port, E_MOTOR_GEARSET_18, reverse, E_MOTOR_ENCODER_DEGREES){}
+
+Motor::Motor(const std::uint8_t port)
+    : Motor(port, E_MOTOR_GEARSET_18, false, E_MOTOR_ENCODER_DEGREES){}
+
+std::int32_t Motor::operator=(std::int32_t voltage) const{
+    return move(voltage);
+}
+
+std::int32_t Motor::move(std::int32_t voltage) const{
+    voltage = voltage > 127 ? 127 : (voltage < -127 ? -127 : voltage);
+    return command(_port, voltage * 12000 / 127);
+}
+
+std::int32_t Motor::move_absolute(const double position, const std::int32_t velocity) const{
+    return 1;
+}
+
+std::int32_t Motor::move_relative(const double position, const std::int32_t velocity) const{
+    return 1;
+}
+
+std::int32_t Motor::move_velocity(const std::int32_t velocity) const{
+    return command(_port, (std::int32_t)(velocity / gearsetRpm(sim::motor(_port).gearset) * 12000));
+}
+
+std::int32_t Motor::move_voltage(const std::int32_t voltage) const{
+    return command(_port, voltage);
+}
+
+std::int32_t Motor::modify_profiled_velocity(const std::int32_t velocity) const{
+    return 1;
+}
+
+double Motor::get_target_position(void) const{
+    return 0;
+}
+
+std::int32_t Motor::get_target_velocity(void) const{
+    return 0;
+}
+
+double Motor::get_actual_velocity(void) const{
+    return sim::motor(_port).velocity;
+}
+
+std::int32_t Motor::get_current_draw(void) const{
+    return sim::motor(_port).current;
+}
+
+std::int32_t Motor::get_direction(void) const{
+    return sim::motor(_port).velocity < 0 ? -1 : 1;
+}
+
+double Motor::get_efficiency(void) const{
+    return 100;
+}
+
+std::int32_t Motor::is_over_current(void) const{
+    return 0;
+}
+
+std::int32_t Motor::is_stopped(void) const{
+    return std::fabs(sim::motor(_port).velocity) < 1;
+}
+
+std::int32_t Motor::get_zero_position_flag(void) const{
+    return 0;
+}
+
+std::uint32_t Motor::get_faults(void) const{
+    return 0;
+}
+
+std::uint32_t Motor::get_flags(void) const{
+    return 0;
+}
+
+std::int32_t Motor::get_raw_position(std::uint32_t* const timestamp) const{
+    if(timestamp != NULL){
+        *timestamp = sim::now();
+    }
+    return (std::int32_t)sim::motor(_port).position;
+}
+
+std::int32_t Motor::is_over_temp(void) const{
+    return 0;
+}
+
+double Motor::get_position(void) const{
+    sim::Motor &m = sim::motor(_port);
+    switch(m.encoderUnits){
+        case E_MOTOR_ENCODER_COUNTS:
+            return m.position;
+        case E_MOTOR_ENCODER_ROTATIONS:
+            return m.position / countsPerRev(m.gearset);
+        default:
+            return m.position / countsPerRev(m.gearset) * 360;
+    }
+}
+
+double Motor::get_power(void) const{
+    sim::Motor &m = sim::motor(_port);
+    return std::fabs(m.voltage / 1000.0 * m.current / 1000.0);
+}
+
+double Motor::get_temperature(void) const{
+    return sim::motor(_port).temperature;
+}
+
+double Motor::get_torque(void) const{
+    return 0;
+}
+
+std::int32_t Motor::get_voltage(void) const{
+    return sim::motor(_port).voltage;
+}
+
+std::int32_t Motor::set_zero_position(const double position) const{
+    sim::Motor &m = sim::motor(_port);
+    double counts = position;
+    if(m.encoderUnits == E_MOTOR_ENCODER_ROTATIONS){
+        counts = position * countsPerRev(m.gearset);
+    }else if(m.encoderUnits == E_MOTOR_ENCODER_DEGREES){
+        counts = position / 360 * countsPerRev(m.gearset);
+    }
+    m.position -= counts;
+    return 1;
+}
+
+std::int32_t Motor::tare_position(void) const{
+    sim::motor(_port).position = 0;
+    return 1;
+}
+
+std::int32_t Motor::set_brake_mode(const motor_brake_mode_e_t mode) const{
+    sim::motor(_port).brakeMode = mode;
+    return 1;
+}
+
+std::int32_t Motor::set_current_limit(const std::int32_t limit) const{
+    return 1;
+}
+
+std::int32_t Motor::set_encoder_units(const motor_encoder_units_e_t units) const{
+    sim::motor(_port).encoderUnits = units;
+    return 1;
+}
+
+std::int32_t Motor::set_gearing(const motor_gearset_e_t gearset) const{
+    sim::motor(_port).gearset = gearset;
+    return 1;
+}
+
+std::int32_t Motor::set_pos_pid(const motor_pid_s_t pid) const{
+    return 1;
+}
+
+std::int32_t Motor::set_pos_pid_full(const motor_pid_full_s_t pid) const{
+    return 1;
+}
+
+std::int32_t Motor::set_vel_pid(const motor_pid_s_t pid) const{
+    return 1;
+}
+
+std::int32_t Motor::set_vel_pid_full(const motor_pid_full_s_t pid) const{
+    return 1;
+}
+
+std::int32_t Motor::set_reversed(const bool reverse) const{
+    sim::motor(_port).reversed = reverse;
+    return 1;
+}
+
+std::int32_t Motor::set_voltage_limit(const std::int32_t limit) const{
+    return 1;
+}
+
+motor_brake_mode_e_t Motor::get_brake_mode(void) const{
+    return (motor_brake_mode_e_t)sim::motor(_port).brakeMode;
+}
+
+std::int32_t Motor::get_current_limit(void) const{
+    return 2500;
+}
+
+motor_encoder_units_e_t Motor::get_encoder_units(void) const{
+    return (motor_encoder_units_e_t)sim::motor(_port).encoderUnits;
+}
+
+motor_gearset_e_t Motor::get_gearing(void) const{
+    return (motor_gearset_e_t)sim::motor(_port).gearset;
+}
+
+motor_pid_full_s_t Motor::get_pos_pid(void) const{
+    return motor_pid_full_s_t{};
+}
+
+motor_pid_full_s_t Motor::get_vel_pid(void) const{
+    return motor_pid_full_s_t{};
+}
+
+std::int32_t Motor::is_reversed(void) const{
+    return sim::motor(_port).reversed;
+}
+
+std::int32_t Motor::get_voltage_limit(void) const{
+    return 12000;
+}
+
+std::uint8_t Motor::get_port(void) const{
+    return _port;
+}
+
+//////////////////////////////////// imu ////////////////////////////////////
+
+std::int32_t Imu::reset() const{
+    sim::resetImu();
+    return 1;
+}
+
+double Imu::get_rotation() const{
+    if(sim::imuCalibrating()){
+        errno = EAGAIN;
+        return INFINITY;
+    }
+    return sim::imuRotation();
+}
+
+double Imu::get_heading() const{
+    if(sim::imuCalibrating()){
+        errno = EAGAIN;
+        return INFINITY;
+    }
+    double heading = std::fmod(sim::imuRotation(), 360);
+    return heading < 0 ? heading + 360 : heading;
+}
+
+pros::c::quaternion_s_t Imu::get_quaternion() const{
+    return pros::c::quaternion_s_t{};
+}
+
+pros::c::euler_s_t Imu::get_euler() const{
+    pros::c::euler_s_t euler{};
+    euler.yaw = get_yaw();
+    return euler;
+}
+
+double Imu::get_pitch() const{
+    return 0;
+}
+
+double Imu::get_roll() const{
+    return 0;
+}
+
+double Imu::get_yaw() const{
+    double heading = get_heading();
+    return heading > 180 ? heading - 360 : heading;
+}
+
+pros::c::imu_gyro_s_t Imu::get_gyro_rate() const{
+    return pros::c::imu_gyro_s_t{};
+}
+
+pros::c::imu_accel_s_t Imu::get_accel() const{
+    return pros::c::imu_accel_s_t{};
+}
+
+pros::c::imu_status_e_t Imu::get_status() const{
+    return sim::imuCalibrating() ? pros::c::E_IMU_STATUS_CALIBRATING : (pros::c::imu_status_e_t)0;
+}
+
+bool Imu::is_calibrating() const{
+    return sim::imuCalibrating();
+}
+
+//////////////////////////////////// adi ////////////////////////////////////
+
+ADIPort::ADIPort(std::uint8_t port, adi_port_config_e_t type){
+    _port = (port >= 'a' && port <= 'h') ? port - 'a' + 1 : ((port >= 'A' && port <= 'H') ? port - 'A' + 1 : port);
+}
+
+std::int32_t ADIPort::get_value(void) const{
+    return sim::adiDigital(_port);
+}
+
+ADIDigitalIn::ADIDigitalIn(std::uint8_t port) : ADIPort(port, E_ADI_DIGITAL_IN){}
+
+///////////////////////////////// controller /////////////////////////////////
+
+Controller::Controller(controller_id_e_t id) : _id(id){}
+
+std::int32_t Controller::is_connected(void){
+    return 1;
+}
+
+std::int32_t Controller::get_analog(controller_analog_e_t channel){
+    return sim::analog(channel);
+}
+
+std::int32_t Controller::get_digital(controller_digital_e_t button){
+    return sim::digital(button);
+}
+
+std::int32_t Controller::rumble(const char* rumble_pattern){
+    return 1;
+}
+
+/////////////////////////////////// rtos ///////////////////////////////////
+
+Task::Task(task_fn_t function, void* parameters, std::uint32_t prio, std::uint16_t stack_depth, const char* name){
+    task = sim::spawn([function, parameters]{ function(parameters); }, prio, name);
+}
+
+Task::Task(task_fn_t function, void* parameters, const char* name)
+    : Task(function, parameters, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, name){}
+
+Task::Task(task_t task) : task(task){}
+
+Task Task::current(){
+    return Task(sim::currentTask());
+}
+
+void Task::remove(){
+    sim::kill(task);
+}
+
+std::uint32_t Task::notify(void){
+    return sim::notify(task, 0, E_NOTIFY_ACTION_INCR, NULL);
+}
+
+std::uint32_t Task::notify_ext(std::uint32_t value, notify_action_e_t action, std::uint32_t* prev_value){
+    return sim::notify(task, value, action, prev_value);
+}
+
+std::uint32_t Task::notify_take(bool clear_on_exit, std::uint32_t timeout){
+    return sim::notifyTake(clear_on_exit, timeout);
+}
+
+bool Task::notify_clear(void){
+    return sim::notifyClear(task);
+}
+
+void Task::delay(const std::uint32_t milliseconds){
+    sim::sleepUntil(sim::now() + milliseconds);
+}
+
+void Task::delay_until(std::uint32_t* const prev_time, const std::uint32_t delta){
+    *prev_time += delta;
+    if(*prev_time > sim::now()){
+        sim::sleepUntil(*prev_time);
+    }
+}
+
+void Task::set_priority(std::uint32_t prio){
+    sim::setPriority(task, prio);
+}
+
+std::uint32_t Task::get_count(void){
+    return sim::taskCount();
+}
+
+namespace c{
+
+uint32_t millis(void){
+    return sim::now();
+}
+
+void delay(const uint32_t milliseconds){
+    sim::sleepUntil(sim::now() + milliseconds);
+}
+
+void task_delay(const uint32_t milliseconds){
+    delay(milliseconds);
+}
+
+void task_delay_until(uint32_t* const prev_time, const uint32_t delta){
+    pros::Task::delay_until(prev_time, delta);
+}
+
+uint32_t task_notify_take(bool clear_on_exit, uint32_t timeout){
+    return sim::notifyTake(clear_on_exit, timeout);
+}
+
+task_t task_get_current(){
+    return sim::currentTask();
+}
+
+//only one task runs at a time in the sim, so a queue is a plain ring and a
+//blocked call just polls it once a millisecond until the timeout
+queue_t queue_create(uint32_t length, uint32_t item_size){
+    SimQueue *q = new SimQueue{length, item_size};
+    q->storage.resize(length * item_size);
+    return q;
+}
+
+bool queue_append(queue_t queue, const void* item, uint32_t timeout){
+    SimQueue *q = static_cast<SimQueue*>(queue);
+    std::uint32_t start = sim::now();
+    while(q->count >= q->length){
+        if(sim::now() - start >= timeout){
+            return false;
+        }
+        delay(1);
+    }
+    std::uint32_t slot = (q->head + q->count) % q->length;
+    std::memcpy(q->storage.data() + slot * q->itemSize, item, q->itemSize);
+    q->count++;
+    return true;
+}
+
+bool queue_recv(queue_t queue, void* const buffer, uint32_t timeout){
+    SimQueue *q = static_cast<SimQueue*>(queue);
+    std::uint32_t start = sim::now();
+    while(q->count == 0){
+        if(sim::now() - start >= timeout){
+            return false;
+        }
+        delay(1);
+    }
+    std::memcpy(buffer, q->storage.data() + q->head * q->itemSize, q->itemSize);
+    q->head = (q->head + 1) % q->length;
+    q->count--;
+    return true;
+}
+
+uint32_t queue_get_waiting(const queue_t queue){
+    return static_cast<SimQueue*>(queue)->count;
+}
+
+int32_t serctl(const uint32_t action, void* const extra_arg){
+    return 1;
+}
+
+int32_t usd_is_installed(void){
+    return usdInstalled;
+}
+
+bool lcd_print(int16_t line, const char* fmt, ...){
+    if(lcdEcho){
+        std::va_list args;
+        va_start(args, fmt);
+        std::printf("[%6u] lcd %d: ", (unsigned)sim::now(), line);
+        std::vprintf(fmt, args);
+        std::printf("\n");
+        va_end(args);
+    }
+    return true;
+}
+
+}
+
+namespace usd{
+
+std::int32_t is_installed(void){
+    return usdInstalled;
+}
+
+}
+
+namespace competition{
+
+std::uint8_t get_status(void){
+    return competitionStatus;
+}
+
+}
+
+namespace lcd{
+
+bool initialize(void){
+    return true;
+}
+
+}
+
+}
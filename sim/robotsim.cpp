@@ -0,0 +1,304 @@
+//runs the competition code on the host against the sim model
+//
+//  robotsim auton <selection>      run initialize() then autonomous(), 4 runs autotune(), 5 characterize()
+//  robotsim drive <feet> <mV>      run a single Robot::drive
+//  robotsim turn <degrees>         run a single Robot::turn
+//  robotsim sprofile <feet>        run a single Robot::driveSProfile
+//  robotsim sineprofile <feet>     run a single Robot::driveSineProfile
+//  robotsim point <x> <y>          run a single Robot::driveToPoint at full speed
+//  robotsim turnpoint <x> <y>      run a single Robot::turnToPoint
+//  robotsim path <x,y> <x,y>...    run a single Robot::followPath at full speed
+//  robotsim trajectory <x,y,deg>...  run Robot::followTrajectory, built through trajectoryCache
+//  robotsim replay <inNNN.bin>     run opcontrol() on a recorded driver input log until it runs out
+//  robotsim batchkill <degrees>    delete a task inside a MotorBatch, then run a Robot::turn
+//
+//options:
+//  --trace <file>    write time, pose and side velocities every 10 ms as csv
+//  --settle <ms>     keep simulating this long after the move returns (default 500)
+//  --lcd             echo lcd prints to stdout
+//  --path <x,y>...   waypoints handed to autonomous() through autonPath
+//  --usd <dir>       act as if an sd card is in, with trajectoryCache, gainsFile, the
+//                    blackbox logs and driver input recordings stored in dir
+//  --turngains <stage> <kP,kI,kD>   override one stage of Robot::turnPID, for gain sweeps
+//  --telemetry <file>   write the telemetry stream (cobs frames) to file instead of dropping it
+//  --heaptrap        stop on the first c++ heap allocation after initialize()
+//  --profile         print the ProfileSection timings after the run. the sim clock only moves
+//                    when tasks sleep, so this shows which sections ran and how often, not cost
+
+//the robot code is header only and written for a single translation unit, so
+//main.cpp is pulled in here instead of being linked separately
+#include "../src/main.cpp"
+
+#include "sim.hpp"
+#include "trajectorycache.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+//selection.cpp needs lvgl, the sim picks the routine from the command line
+int autonSelection = 3;
+void selectorInit(){}
+
+//the trajectory scenario's paths, kept in the --usd directory when given
+TrajectoryCache trajectoryCache("/usd");
+
+namespace{
+
+bool parseWaypoint(const char *text, Waypoint &point){
+    return std::sscanf(text, "%lf,%lf", &point.x, &point.y) == 2;
+}
+
+void usage(){
+    std::fprintf(stderr,
+        "usage: robotsim auton <selection> | drive <feet> <mV> | turn <degrees>\n"
+        "                | sprofile <feet> | sineprofile <feet> | point <x> <y> | turnpoint <x> <y>\n"
+        "                | path <x,y> <x,y>... | trajectory <x,y,deg> <x,y,deg>... | replay <inNNN.bin>\n"
+        "                | batchkill <degrees>\n"
+        "                [--trace file.csv] [--settle ms] [--lcd] [--path <x,y> <x,y>...] [--usd dir]\n"
+        "                [--turngains stage kP,kI,kD] [--telemetry file] [--profile] [--heaptrap]\n");
+    std::exit(2);
+}
+
+}
+
+int main(int argc, char **argv){
+    std::vector<std::string> args;
+    const char *tracePath = nullptr;
+    //stdout is the report here, telemetry only goes out when asked for
+    telemetryStream = nullptr;
+    std::uint32_t settle = 500;
+    bool profile = false;
+    for(int i = 1; i < argc; i++){
+        if(std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc){
+            tracePath = argv[++i];
+        }else if(std::strcmp(argv[i], "--settle") == 0 && i + 1 < argc){
+            settle = std::atoi(argv[++i]);
+        }else if(std::strcmp(argv[i], "--heaptrap") == 0){
+            heapguard::trap = true;
+        }else if(std::strcmp(argv[i], "--profile") == 0){
+            profile = true;
+        }else if(std::strcmp(argv[i], "--lcd") == 0){
+            sim::setLcdEcho(true);
+        }else if(std::strcmp(argv[i], "--usd") == 0 && i + 1 < argc){
+            sim::setUsdInstalled(true);
+            trajectoryCache.setDirectory(argv[++i]);
+            gainsFile = std::string(argv[i]) + "/gains.txt";
+            logDirectory = argv[i];
+            replayFile = std::string(argv[i]) + "/replay.bin";
+        }else if(std::strcmp(argv[i], "--telemetry") == 0 && i + 1 < argc){
+            telemetryStream = std::fopen(argv[++i], "wb");
+            if(telemetryStream == nullptr){
+                std::perror(argv[i]);
+                return 1;
+            }
+        }else if(std::strcmp(argv[i], "--turngains") == 0 && i + 2 < argc){
+            PIDGains gains;
+            std::size_t stage = std::atoi(argv[++i]);
+            if(std::sscanf(argv[++i], "%lf,%lf,%lf", &gains.kP, &gains.kI, &gains.kD) != 3){
+                usage();
+            }
+            robot.turnPID.setGains(stage, gains);
+        }else if(std::strcmp(argv[i], "--path") == 0){
+            Waypoint point;
+            while(i + 1 < argc && parseWaypoint(argv[i + 1], point)){
+                autonPath.push_back(point);
+                i++;
+            }
+        }else{
+            args.push_back(argv[i]);
+        }
+    }
+    if(args.empty()){
+        usage();
+    }
+    //initialize() picks the replay up the way it would from the card
+    if(args[0] == "replay" && args.size() == 2){
+        replayFile = args[1];
+        replayRequested = true;
+    }
+
+    sim::init();
+    sim::setDrivePorts(robot.left_drive1.get_port(), robot.left_drive2.get_port(),
+                       robot.right_drive1.get_port(), robot.right_drive2.get_port());
+
+    FILE *trace = nullptr;
+    if(tracePath != nullptr){
+        trace = std::fopen(tracePath, "w");
+        if(trace == nullptr){
+            std::perror(tracePath);
+            return 1;
+        }
+        std::fprintf(trace, "time,x,y,theta,left_vel,right_vel\n");
+        sim::setObserver([trace](std::uint32_t time){
+            if(time % 10 == 0){
+                sim::Pose &p = sim::pose();
+                std::fprintf(trace, "%u,%.4f,%.4f,%.3f,%.4f,%.4f\n", (unsigned)time,
+                             p.x, p.y, p.theta, sim::leftVelocity(), sim::rightVelocity());
+            }
+        });
+    }
+
+    initialize();
+
+    auto wallStart = std::chrono::steady_clock::now();
+    std::uint32_t start = pros::millis();
+    double target = 0;
+    double targetY = 0;
+    bool turning = false;
+
+    if(args[0] == "auton" && args.size() == 2){
+        sim::setCompetitionStatus(COMPETITION_AUTONOMOUS);
+        autonSelection = std::atoi(args[1].c_str());
+        autonomous();
+    }else if(args[0] == "drive" && args.size() == 3){
+        target = std::atof(args[1].c_str());
+        robot.drive(target, std::atoi(args[2].c_str()));
+    }else if(args[0] == "sprofile" && args.size() == 2){
+        target = std::atof(args[1].c_str());
+        robot.driveSProfile(target);
+    }else if(args[0] == "sineprofile" && args.size() == 2){
+        target = std::atof(args[1].c_str());
+        robot.driveSineProfile(target);
+    }else if(args[0] == "point" && args.size() == 3){
+        target = std::atof(args[1].c_str());
+        targetY = std::atof(args[2].c_str());
+        robot.driveToPoint(target, targetY, MAX_VOLTAGE);
+    }else if(args[0] == "turnpoint" && args.size() == 3){
+        target = std::atof(args[1].c_str());
+        targetY = std::atof(args[2].c_str());
+        robot.turnToPoint(target, targetY);
+    }else if(args[0] == "path" && args.size() >= 3){
+        std::vector<Waypoint> path;
+        {
+            //the robot would have its paths before initialize() returned
+            heapguard::Unlocked unlocked;
+            for(std::size_t i = 1; i < args.size(); i++){
+                Waypoint point;
+                if(!parseWaypoint(args[i].c_str(), point)){
+                    usage();
+                }
+                path.push_back(point);
+            }
+        }
+        target = path.back().x;
+        targetY = path.back().y;
+        robot.followPath(path, MAX_VOLTAGE);
+    }else if(args[0] == "trajectory" && args.size() >= 3){
+        Trajectory trajectory;
+        double generateTime;
+        {
+            //generated where initialize() would, the robot only follows it
+            heapguard::Unlocked unlocked;
+            std::vector<PathPose> poses;
+            for(std::size_t i = 1; i < args.size(); i++){
+                PathPose pose;
+                if(std::sscanf(args[i].c_str(), "%lf,%lf,%lf", &pose.x, &pose.y, &pose.heading) != 3){
+                    usage();
+                }
+                poses.push_back(pose);
+            }
+            target = poses.back().x;
+            targetY = poses.back().y;
+            //same limits as the profiled drives, track width from Robot
+            auto generateStart = std::chrono::steady_clock::now();
+            trajectory = trajectoryCache.get(poses, {3.7, 6, 30}, 12.5 / 12, 0.01);
+            generateTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - generateStart).count();
+        }
+        std::printf("trajectory:    %d segments, cache %s in %.3f ms wall\n", trajectory.length,
+                    trajectoryCache.getHits() > 0 ? "hit" : "miss", generateTime * 1000);
+        robot.followTrajectory(trajectory);
+    }else if(args[0] == "replay" && args.size() == 2){
+        if(!driverInput.isReplaying()){
+            std::fprintf(stderr, "%s: not a driver input log\n", args[1].c_str());
+            return 1;
+        }
+        {
+            //opcontrol() goes on with the idle controller afterwards, like the
+            //robot would, so it gets its own task the way the kernel starts it
+            heapguard::Unlocked unlocked;
+            new pros::Task([]{ opcontrol(); }, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "opcontrol");
+        }
+        while(driverInput.isReplaying()){
+            pros::delay(1);
+        }
+        std::printf("replayed:      %u frames\n", (unsigned)driverInput.getReplayLength());
+    }else if(args[0] == "batchkill" && args.size() == 2){
+        //the kernel deletes a competition task wherever it is when the mode
+        //changes, this one goes with its batch still open. what it set never
+        //goes out, and the turn after must drive as if it had never run
+        pros::Task *doomed;
+        {
+            heapguard::Unlocked unlocked;
+            doomed = new pros::Task([]{
+                MotorBatch batch(robot.output);
+                robot.setDriveVoltage(MAX_VOLTAGE);
+                pros::delay(1000);
+            }, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "doomed");
+        }
+        pros::delay(10);
+        doomed->remove();
+        //the kernel runs the next mode on the same task handle, the main task
+        //stands in for that with a batch it never closes
+        robot.output.beginBatch();
+        robot.setDriveVoltage(MAX_VOLTAGE);
+        robot.output.invalidate();
+        target = std::atof(args[1].c_str());
+        turning = true;
+        robot.turn(target);
+        std::printf("recoveries:    %u\n", (unsigned)robot.output.getRecoveries());
+    }else if(args[0] == "turn" && args.size() == 2){
+        target = std::atof(args[1].c_str());
+        turning = true;
+        robot.turn(target);
+    }else{
+        usage();
+    }
+
+    std::uint32_t done = pros::millis();
+    sim::Pose atDone = sim::pose();
+    pros::delay(settle);
+    sim::Pose &p = sim::pose();
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    std::printf("move time:     %u ms\n", (unsigned)(done - start));
+    std::printf("pose at done:  x %.3f ft, y %.3f ft, theta %.2f deg\n", atDone.x, atDone.y, atDone.theta);
+    std::printf("pose settled:  x %.3f ft, y %.3f ft, theta %.2f deg\n", p.x, p.y, p.theta);
+    Pose odom = robot.getPose();
+    std::printf("odometry:      x %.3f ft, y %.3f ft, theta %.2f deg\n", odom.x, odom.y, odom.theta);
+    if(args[0] == "drive" || args[0] == "sprofile" || args[0] == "sineprofile"){
+        std::printf("distance err:  %.3f ft\n", std::hypot(p.x, p.y) - std::fabs(target));
+    }else if(args[0] == "point" || args[0] == "path" || args[0] == "trajectory"){
+        std::printf("distance err:  %.3f ft\n", std::hypot(p.x - target, p.y - targetY));
+    }else if(args[0] == "turnpoint"){
+        std::printf("heading err:   %.2f deg\n", p.theta - std::atan2(targetY, target) * 180 / M_PI);
+    }else if(turning){
+        std::printf("heading err:   %.2f deg\n", p.theta - target);
+    }
+    std::printf("motor writes:  %u, %u unchanged skipped\n",
+                (unsigned)robot.output.getWrites(), (unsigned)robot.output.getSkips());
+    std::printf("late allocs:   %u\n", (unsigned)heapguard::getLateAllocations());
+    if(!robot.blackbox.getFileName().empty()){
+        std::printf("blackbox:      %u records to %s, %u dropped\n", (unsigned)robot.blackbox.getWritten(),
+                    robot.blackbox.getFileName().c_str(), (unsigned)robot.blackbox.getDropped());
+    }
+    if(telemetryStream != nullptr){
+        std::printf("telemetry:     %u records sent, %u dropped\n",
+                    (unsigned)robot.telemetry.getSent(), (unsigned)robot.telemetry.getDropped());
+    }
+    std::printf("simulated:     %u ms in %.3f s wall (%.0fx real time)\n",
+                (unsigned)(pros::millis() - start), wall, (pros::millis() - start) / 1000.0 / wall);
+
+    if(profile){
+        ProfileSection::dumpAll(stdout);
+    }
+
+    if(trace != nullptr){
+        sim::setObserver(nullptr);
+        std::fclose(trace);
+    }
+    std::fflush(stdout);
+    std::_Exit(0);
+}
@@ -0,0 +1,217 @@
+#include "sim.hpp"
+
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sim{
+
+namespace{
+
+const std::uint32_t forever = 0xffffffff;
+
+struct Task{
+    std::string name;
+    std::uint32_t prio = 8;
+    std::function<void()> fn;
+    std::uint32_t wake = 0;         //clock time the task becomes ready
+    std::uint64_t order = 0;        //fifo tie break between equal tasks
+    bool done = false;
+    bool waitingNotify = false;
+    std::uint32_t notifyValue = 0;
+    bool notifyPending = false;     //notified since the last take or clear, even with a value of 0
+    std::condition_variable cv;
+};
+
+std::mutex lock;
+std::vector<Task*> tasks;
+Task *current = nullptr;
+std::uint32_t clockMs = 0;
+std::uint64_t orderCounter = 0;
+
+Task *pickNext(){
+    Task *best = nullptr;
+    for(Task *t : tasks){
+        if(t->done){
+            continue;
+        }
+        if(best == nullptr || t->wake < best->wake ||
+           (t->wake == best->wake && (t->prio > best->prio ||
+           (t->prio == best->prio && t->order < best->order)))){
+            best = t;
+        }
+    }
+    return best;
+}
+
+//hand the cpu to whichever task is due next, advancing the clock (and the
+//physics) up to its wake time. returns once the calling task runs again
+void switchAway(std::unique_lock<std::mutex> &lk){
+    Task *me = current;
+    me->order = ++orderCounter;
+
+    Task *next = pickNext();
+    if(next == nullptr){
+        //every task has exited
+        std::fflush(stdout);
+        std::_Exit(0);
+    }
+    if(next->wake == forever){
+        std::fprintf(stderr, "sim: deadlock at %u ms, every task is waiting forever\n", (unsigned)clockMs);
+        std::fflush(stdout);
+        std::_Exit(1);
+    }
+    while(clockMs < next->wake){
+        step();
+        clockMs++;
+    }
+    current = next;
+    next->waitingNotify = false;
+    next->cv.notify_one();
+
+    if(!me->done){
+        me->cv.wait(lk, [me]{ return current == me; });
+    }
+}
+
+}
+
+void init(){
+    std::unique_lock<std::mutex> lk(lock);
+    Task *t = new Task();
+    t->name = "main";
+    tasks.push_back(t);
+    current = t;
+}
+
+std::uint32_t now(){
+    return clockMs;
+}
+
+void sleepUntil(std::uint32_t time){
+    std::unique_lock<std::mutex> lk(lock);
+    current->wake = time > clockMs ? time : clockMs;
+    switchAway(lk);
+}
+
+void* spawn(std::function<void()> fn, std::uint32_t prio, const char *name){
+    std::unique_lock<std::mutex> lk(lock);
+    Task *t = new Task();
+    t->name = name == nullptr ? "" : name;
+    t->prio = prio;
+    t->fn = fn;
+    t->wake = clockMs;
+    t->order = ++orderCounter;
+    tasks.push_back(t);
+
+    std::thread([t]{
+        {
+            std::unique_lock<std::mutex> lk(lock);
+            t->cv.wait(lk, [t]{ return current == t; });
+        }
+        t->fn();
+        std::unique_lock<std::mutex> lk(lock);
+        t->done = true;
+        switchAway(lk);
+    }).detach();
+
+    //a new task preempts its creator when it has a higher priority
+    if(prio > current->prio){
+        current->wake = clockMs;
+        switchAway(lk);
+    }
+    return t;
+}
+
+void kill(void *handle){
+    Task *t = handle == nullptr ? current : static_cast<Task*>(handle);
+    std::unique_lock<std::mutex> lk(lock);
+    t->done = true;
+    if(t == current){
+        switchAway(lk);
+        //a task that deletes itself never comes back
+        for(;;){
+            t->cv.wait(lk);
+        }
+    }
+}
+
+void* currentTask(){
+    return current;
+}
+
+void setPriority(void *handle, std::uint32_t prio){
+    Task *t = handle == nullptr ? current : static_cast<Task*>(handle);
+    std::unique_lock<std::mutex> lk(lock);
+    t->prio = prio;
+}
+
+//action follows notify_action_e_t: 0 none, 1 bits, 2 incr, 3 overwrite, 4 no overwrite.
+//returns 1 (pdPASS), or 0 (pdFAIL) for no overwrite with a notification still pending
+std::uint32_t notify(void *handle, std::uint32_t value, int action, std::uint32_t *prev){
+    std::unique_lock<std::mutex> lk(lock);
+    Task *t = static_cast<Task*>(handle);
+    if(prev != nullptr){
+        *prev = t->notifyValue;
+    }
+    std::uint32_t result = 1;
+    switch(action){
+        case 1: t->notifyValue |= value; break;
+        case 2: t->notifyValue++; break;
+        case 3: t->notifyValue = value; break;
+        case 4:
+            if(t->notifyPending){
+                result = 0;
+            }else{
+                t->notifyValue = value;
+            }
+            break;
+        default: break;
+    }
+    t->notifyPending = true;
+    if(t->waitingNotify){
+        t->waitingNotify = false;
+        t->wake = clockMs;
+    }
+    return result;
+}
+
+std::uint32_t notifyTake(bool clearOnExit, std::uint32_t timeout){
+    std::unique_lock<std::mutex> lk(lock);
+    Task *me = current;
+    if(me->notifyValue == 0 && timeout > 0){
+        me->waitingNotify = true;
+        me->wake = timeout == forever ? forever : clockMs + timeout;
+        switchAway(lk);
+    }
+    std::uint32_t value = me->notifyValue;
+    if(value > 0){
+        me->notifyValue = clearOnExit ? 0 : value - 1;
+    }
+    me->notifyPending = false;
+    return value;
+}
+
+bool notifyClear(void *handle){
+    std::unique_lock<std::mutex> lk(lock);
+    Task *t = static_cast<Task*>(handle);
+    bool waiting = t->notifyPending;
+    t->notifyPending = false;
+    t->notifyValue = 0;
+    return waiting;
+}
+
+std::uint32_t taskCount(){
+    std::unique_lock<std::mutex> lk(lock);
+    std::uint32_t count = 0;
+    for(Task *t : tasks){
+        count += t->done ? 0 : 1;
+    }
+    return count;
+}
+
+}
@@ -0,0 +1,102 @@
+#ifndef SIM_HPP
+#define SIM_HPP
+
+#include <cstdint>
+#include <functional>
+
+//host-side stand-in for the V5 brain. the robot code is compiled against the
+//real pros headers and sim/pros.cpp implements those calls on top of a
+//virtual clock and a differential-drive physics model, so whole autonomous
+//routines run in a fraction of a second
+namespace sim{
+
+//////////////////////////////// scheduler ////////////////////////////////
+//tasks are real threads, but only one runs at a time and the clock only
+//advances when every task is blocked, so runs are deterministic and never
+//wait on the wall clock
+
+//register the calling thread as the first task, must run before anything else
+void init();
+std::uint32_t now();
+void sleepUntil(std::uint32_t);
+void* spawn(std::function<void()>, std::uint32_t, const char*);
+void kill(void*);
+void* currentTask();
+void setPriority(void*, std::uint32_t);
+std::uint32_t notify(void*, std::uint32_t, int, std::uint32_t*);
+std::uint32_t notifyTake(bool, std::uint32_t);
+bool notifyClear(void*);
+std::uint32_t taskCount();
+
+//////////////////////////////// physics ////////////////////////////////
+
+struct Params{
+    double trackWidth = 1.05;       //ft, effective wheel to wheel distance
+    double wheelDiameter = 3.25;    //in
+    double ticksPerWheelRev = 540;  //motor encoder counts per wheel turn
+    double motorRatio = 0.6;        //motor turns per wheel turn
+    double freeRpm = 200;           //green cartridge
+    double timeConstant = 0.12;     //s, first order spin up of each side
+    double brakeTimeConstant = 0.04;//s, when commanded to 0 in brake mode
+    double staticFriction = 0.08;   //fraction of full voltage needed to move
+    double scrub = 0.85;            //fraction of wheel speed difference that turns the robot
+};
+
+struct Motor{
+    bool used = false;
+    bool reversed = false;
+    int gearset = 1;
+    int brakeMode = 0;
+    int encoderUnits = 0;
+    std::int32_t voltage = 0;       //mV, as commanded
+    double velocity = 0;            //rpm
+    double position = 0;            //encoder counts
+    double temperature = 25;
+    std::int32_t current = 0;       //mA
+    std::uint32_t commands = 0;     //number of writes, to measure bus traffic
+};
+
+struct Pose{
+    double x = 0;                   //ft, forward at start
+    double y = 0;                   //ft, right at start
+    double theta = 0;               //deg, clockwise like the imu
+};
+
+Params &params();
+Motor &motor(int);
+Pose &pose();
+double leftVelocity();             //ft/s
+double rightVelocity();            //ft/s
+
+void setDrivePorts(int, int, int, int);
+void setImuCalibrationTime(std::uint32_t);
+void resetImu();
+bool imuCalibrating();
+double imuRotation();
+
+void setAnalog(int, std::int32_t);
+void setDigital(int, bool);
+std::int32_t analog(int);
+bool digital(int);
+void setAdiDigital(int, bool);
+bool adiDigital(int);
+
+//print pros::lcd::print calls to stdout
+void setLcdEcho(bool);
+
+//report an sd card to the robot code. /usd paths aren't remapped, so code
+//that writes to the card has to be pointed at a host directory as well
+void setUsdInstalled(bool);
+
+//what pros::competition::get_status() reports, COMPETITION_* bits
+void setCompetitionStatus(std::uint8_t);
+
+//advance the model by one millisecond, called by the scheduler
+void step();
+
+//called every millisecond after the model steps, e.g. for tracing
+void setObserver(std::function<void(std::uint32_t)>);
+
+}
+
+#endif
@@ -0,0 +1,212 @@
+#ifndef TRAJECTORYCACHE_HPP
+#define TRAJECTORYCACHE_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include "main.h"
+#include "../src/trajectory.hpp"
+
+//bump whenever generateTrajectory or the file layout changes, old files then
+//count as misses and get rewritten
+#define TRAJECTORY_CACHE_VERSION 1
+
+//counts past these in a file mean it's damaged, not a path anyone drives.
+//a minute of segments at 10 ms
+#define TRAJECTORY_CACHE_MAX_POSES 256
+#define TRAJECTORY_CACHE_MAX_LENGTH 6000
+
+//start of every cache file. the inputs are stored after it so a hash
+//collision can't hand back the wrong path, then the left and right segments
+struct TrajectoryFileHeader{
+    char magic[4];              //"TRAJ"
+    std::uint16_t version;
+    std::uint16_t segmentSize;  //sizeof(TrajectorySegment), catches layout changes
+    std::uint32_t key;
+    std::uint32_t poseCount;
+    std::uint32_t length;       //segments per side
+    std::uint32_t checksum;     //of the segments
+};
+
+//generated trajectories saved to a directory, so a path is only built the
+//first time it's ever asked for. each one is keyed by a hash of its poses,
+//limits, track width and dt and lives in its own small file. without the
+//directory it still works, it just generates every run.
+//host side only: get() allocates and does file i/o, which the robot can't
+//once heapguard is locked, so match paths are compiled in by pathgen instead
+class TrajectoryCache{
+    public:
+        TrajectoryCache(std::string);
+        Trajectory get(const std::vector<PathPose>&, ProfileLimits, double, double);
+        void setDirectory(std::string);
+        int getHits();
+        int getMisses();
+
+    private:
+        struct Entry{
+            std::vector<TrajectorySegment> left;
+            std::vector<TrajectorySegment> right;
+        };
+        struct Inputs{
+            ProfileLimits limits;
+            double trackWidth;
+            double dt;
+        };
+
+        static std::uint32_t hash(const void*, std::size_t, std::uint32_t);
+        std::string fileName(std::uint32_t);
+        bool load(std::uint32_t, const std::vector<PathPose>&, const Inputs&, Entry&);
+        void store(std::uint32_t, const std::vector<PathPose>&, const Inputs&, const Entry&);
+
+        std::string directory;
+        std::map<std::uint32_t, Entry> entries;   //owns the segments handed out
+        int hits;
+        int misses;
+};
+
+inline TrajectoryCache::TrajectoryCache(std::string dir){
+    directory = dir;
+    hits = 0;
+    misses = 0;
+}
+
+//fnv-1a, small and good enough to name files
+inline std::uint32_t TrajectoryCache::hash(const void *data, std::size_t size, std::uint32_t seed){
+    const unsigned char *bytes = (const unsigned char*)data;
+    for(std::size_t i = 0; i < size; i++){
+        seed = (seed ^ bytes[i]) * 16777619u;
+    }
+    return seed;
+}
+
+//8.3 names so the brain's fat driver is happy
+inline std::string TrajectoryCache::fileName(std::uint32_t key){
+    char name[16];
+    std::snprintf(name, sizeof(name), "%08lx.trj", (unsigned long)key);
+    return directory + "/" + name;
+}
+
+//the returned trajectory stays valid for as long as the cache does
+inline Trajectory TrajectoryCache::get(const std::vector<PathPose> &poses, ProfileLimits limits, double trackWidth, double dt){
+    Inputs inputs = {limits, trackWidth, dt};
+    std::uint32_t key = 2166136261u;
+    std::uint32_t version = TRAJECTORY_CACHE_VERSION;
+    key = hash(&version, sizeof(version), key);
+    key = hash(poses.data(), poses.size() * sizeof(PathPose), key);
+    key = hash(&inputs, sizeof(inputs), key);
+
+    auto found = entries.find(key);
+    if(found == entries.end()){
+        Entry entry;
+        if(load(key, poses, inputs, entry)){
+            hits++;
+        }else{
+            misses++;
+            generateTrajectory(poses, limits, trackWidth, dt, entry.left, entry.right);
+            store(key, poses, inputs, entry);
+        }
+        found = entries.emplace(key, std::move(entry)).first;
+    }
+    return {found->second.left.data(), found->second.right.data(), (int)found->second.left.size()};
+}
+
+inline bool TrajectoryCache::load(std::uint32_t key, const std::vector<PathPose> &poses, const Inputs &inputs, Entry &entry){
+    if(!pros::usd::is_installed()){
+        return false;
+    }
+    FILE *file = std::fopen(fileName(key).c_str(), "rb");
+    if(file == nullptr){
+        return false;
+    }
+
+    //the counts come off the card, nothing is sized from them until they fit
+    //the limits and add up to exactly the file that's there
+    long fileSize = -1;
+    if(std::fseek(file, 0, SEEK_END) == 0){
+        fileSize = std::ftell(file);
+        std::rewind(file);
+    }
+    TrajectoryFileHeader header;
+    std::vector<PathPose> storedPoses;
+    Inputs storedInputs;
+    bool valid = std::fread(&header, sizeof(header), 1, file) == 1
+        && std::memcmp(header.magic, "TRAJ", 4) == 0
+        && header.version == TRAJECTORY_CACHE_VERSION
+        && header.segmentSize == sizeof(TrajectorySegment)
+        && header.key == key
+        && header.poseCount == poses.size()
+        && header.poseCount <= TRAJECTORY_CACHE_MAX_POSES
+        && header.length <= TRAJECTORY_CACHE_MAX_LENGTH
+        && fileSize == (long)(sizeof(header) + header.poseCount * sizeof(PathPose) + sizeof(Inputs)
+                              + 2 * header.length * sizeof(TrajectorySegment));
+    if(valid){
+        storedPoses.resize(header.poseCount);
+        valid = std::fread(storedPoses.data(), sizeof(PathPose), storedPoses.size(), file) == storedPoses.size()
+            && std::fread(&storedInputs, sizeof(storedInputs), 1, file) == 1
+            && std::memcmp(storedPoses.data(), poses.data(), poses.size() * sizeof(PathPose)) == 0
+            && std::memcmp(&storedInputs, &inputs, sizeof(inputs)) == 0;
+    }
+    if(valid){
+        entry.left.resize(header.length);
+        entry.right.resize(header.length);
+        valid = std::fread(entry.left.data(), sizeof(TrajectorySegment), header.length, file) == header.length
+            && std::fread(entry.right.data(), sizeof(TrajectorySegment), header.length, file) == header.length;
+    }
+    std::fclose(file);
+
+    if(valid){
+        std::uint32_t checksum = hash(entry.left.data(), header.length * sizeof(TrajectorySegment), 2166136261u);
+        checksum = hash(entry.right.data(), header.length * sizeof(TrajectorySegment), checksum);
+        valid = checksum == header.checksum;
+    }
+    if(!valid){
+        entry.left.clear();
+        entry.right.clear();
+    }
+    return valid;
+}
+
+inline void TrajectoryCache::store(std::uint32_t key, const std::vector<PathPose> &poses, const Inputs &inputs, const Entry &entry){
+    if(!pros::usd::is_installed()){
+        return;
+    }
+    FILE *file = std::fopen(fileName(key).c_str(), "wb");
+    if(file == nullptr){
+        return;
+    }
+
+    TrajectoryFileHeader header;
+    std::memcpy(header.magic, "TRAJ", 4);
+    header.version = TRAJECTORY_CACHE_VERSION;
+    header.segmentSize = sizeof(TrajectorySegment);
+    header.key = key;
+    header.poseCount = poses.size();
+    header.length = entry.left.size();
+    header.checksum = hash(entry.left.data(), entry.left.size() * sizeof(TrajectorySegment), 2166136261u);
+    header.checksum = hash(entry.right.data(), entry.right.size() * sizeof(TrajectorySegment), header.checksum);
+
+    std::fwrite(&header, sizeof(header), 1, file);
+    std::fwrite(poses.data(), sizeof(PathPose), poses.size(), file);
+    std::fwrite(&inputs, sizeof(inputs), 1, file);
+    std::fwrite(entry.left.data(), sizeof(TrajectorySegment), entry.left.size(), file);
+    std::fwrite(entry.right.data(), sizeof(TrajectorySegment), entry.right.size(), file);
+    std::fclose(file);
+}
+
+//where the files go, "/usd" on the brain
+inline void TrajectoryCache::setDirectory(std::string dir){
+    directory = dir;
+}
+
+inline int TrajectoryCache::getHits(){
+    return hits;
+}
+
+inline int TrajectoryCache::getMisses(){
+    return misses;
+}
+
+#endif
@@ -0,0 +1,173 @@
+#include "sim.hpp"
+
+#include <cmath>
+
+namespace sim{
+
+namespace{
+
+Params simParams;
+Motor motors[22];
+Pose robotPose;
+int leftPorts[2] = {0, 0};
+int rightPorts[2] = {0, 0};
+double leftVel = 0;                 //ft/s
+double rightVel = 0;                //ft/s
+std::uint32_t imuCalibrationTime = 2000;
+std::uint32_t imuCalibrationDone = 0;
+std::int32_t analogs[4] = {0, 0, 0, 0};
+bool digitals[12] = {};
+bool adiDigitals[8] = {};
+std::function<void(std::uint32_t)> observer;
+
+const double dt = 0.001;
+
+double countsPerRev(int gearset){
+    return gearset == 0 ? 1800 : (gearset == 2 ? 300 : 900);
+}
+
+double gearsetRpm(int gearset){
+    return gearset == 0 ? 100 : (gearset == 2 ? 600 : 200);
+}
+
+//fraction of full speed a voltage command settles to, once static friction
+//has been overcome
+double effort(double voltage){
+    double u = voltage / 12000.0;
+    double mag = std::fabs(u) - simParams.staticFriction;
+    if(mag <= 0){
+        return 0;
+    }
+    return std::copysign(mag / (1 - simParams.staticFriction), u);
+}
+
+bool isDrivePort(int port){
+    return port == leftPorts[0] || port == leftPorts[1] ||
+           port == rightPorts[0] || port == rightPorts[1];
+}
+
+double stepSide(int *ports, double vel){
+    Motor &a = motors[ports[0]];
+    Motor &b = motors[ports[1]];
+    double freeSpeed = simParams.freeRpm / simParams.motorRatio / 60 * M_PI * simParams.wheelDiameter / 12;
+    double target = freeSpeed * (effort(a.voltage) + effort(b.voltage)) / 2;
+    bool braking = a.voltage == 0 && b.voltage == 0 && a.brakeMode != 0;
+    double tau = braking ? simParams.brakeTimeConstant : simParams.timeConstant;
+    return vel + (target - vel) * dt / tau;
+}
+
+void updateSideMotor(int port, double vel){
+    Motor &m = motors[port];
+    double wheelRpm = vel * 12 / (M_PI * simParams.wheelDiameter) * 60;
+    m.velocity = wheelRpm * simParams.motorRatio;
+    m.position += m.velocity / 60 * dt * countsPerRev(m.gearset);
+    m.current = (std::int32_t)(std::fabs(m.voltage / 12000.0 - m.velocity / gearsetRpm(m.gearset)) * 2500);
+}
+
+}
+
+Params &params(){
+    return simParams;
+}
+
+Motor &motor(int port){
+    return motors[port];
+}
+
+Pose &pose(){
+    return robotPose;
+}
+
+double leftVelocity(){
+    return leftVel;
+}
+
+double rightVelocity(){
+    return rightVel;
+}
+
+void setDrivePorts(int left1, int left2, int right1, int right2){
+    leftPorts[0] = left1;
+    leftPorts[1] = left2;
+    rightPorts[0] = right1;
+    rightPorts[1] = right2;
+}
+
+void setImuCalibrationTime(std::uint32_t ms){
+    imuCalibrationTime = ms;
+}
+
+void resetImu(){
+    imuCalibrationDone = now() + imuCalibrationTime;
+}
+
+bool imuCalibrating(){
+    return now() < imuCalibrationDone;
+}
+
+double imuRotation(){
+    return robotPose.theta;
+}
+
+void setAnalog(int channel, std::int32_t value){
+    analogs[channel] = value;
+}
+
+void setDigital(int button, bool value){
+    digitals[button - 6] = value;
+}
+
+std::int32_t analog(int channel){
+    return analogs[channel];
+}
+
+bool digital(int button){
+    return digitals[button - 6];
+}
+
+void setAdiDigital(int port, bool value){
+    adiDigitals[port - 1] = value;
+}
+
+bool adiDigital(int port){
+    return adiDigitals[port - 1];
+}
+
+void step(){
+    if(leftPorts[0] != 0){
+        leftVel = stepSide(leftPorts, leftVel);
+        rightVel = stepSide(rightPorts, rightVel);
+
+        double forward = (leftVel + rightVel) / 2;
+        double omega = (leftVel - rightVel) / simParams.trackWidth * simParams.scrub;
+        double heading = robotPose.theta * M_PI / 180;
+        robotPose.x += forward * std::cos(heading) * dt;
+        robotPose.y += forward * std::sin(heading) * dt;
+        robotPose.theta += omega * dt * 180 / M_PI;
+
+        updateSideMotor(leftPorts[0], leftVel);
+        updateSideMotor(leftPorts[1], leftVel);
+        updateSideMotor(rightPorts[0], rightVel);
+        updateSideMotor(rightPorts[1], rightVel);
+    }
+
+    for(int port = 1; port <= 21; port++){
+        Motor &m = motors[port];
+        if(!m.used || isDrivePort(port)){
+            continue;
+        }
+        double target = gearsetRpm(m.gearset) * effort(m.voltage);
+        m.velocity += (target - m.velocity) * dt / simParams.timeConstant;
+        m.position += m.velocity / 60 * dt * countsPerRev(m.gearset);
+    }
+
+    if(observer){
+        observer(now() + 1);
+    }
+}
+
+void setObserver(std::function<void(std::uint32_t)> fn){
+    observer = fn;
+}
+
+}
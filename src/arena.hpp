@@ -0,0 +1,196 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+//bump allocator over a fixed buffer. allocating is a pointer move and
+//nothing is freed on its own, the whole arena is emptied at once with
+//reset() when everything built from it is gone. when it runs out the request
+//goes to the heap instead so the robot keeps working, and is counted.
+//an arena shared between tasks is claimed with acquire() first, usually
+//through an ArenaLease, so nobody empties it under someone else
+class Arena{
+    public:
+        Arena(unsigned char*, std::size_t);
+        void *allocate(std::size_t, std::size_t);
+        bool owns(const void*);
+        bool acquire();
+        void release();
+        void reset();
+        std::size_t getUsed();
+        std::size_t getHighWater();
+        std::size_t getCapacity();
+        std::uint32_t getOverflows();
+
+    private:
+        unsigned char *buffer;
+        std::size_t capacity;
+        std::size_t used;
+        std::size_t highWater;
+        std::uint32_t overflows;
+        std::atomic<bool> held;
+};
+
+//holds an arena for its scope, emptied when it's taken
+class ArenaLease{
+    public:
+        ArenaLease(Arena&);
+        ~ArenaLease();
+        bool isHeld();
+
+    private:
+        Arena &arena;
+        bool held;
+};
+
+//an arena with its own storage, static when it's a global or a member of one
+template <std::size_t N>
+class StaticArena : public Arena{
+    public:
+        StaticArena();
+
+    private:
+        alignas(std::max_align_t) unsigned char storage[N];
+};
+
+//lets standard containers draw from an arena, e.g.
+//std::vector<double, ArenaAllocator<double>> v(ArenaAllocator<double>(arena));
+//reserve() the final size up front, every regrowth leaves the old block
+//behind until the next reset
+template <typename T>
+class ArenaAllocator{
+    public:
+        typedef T value_type;
+
+        ArenaAllocator(Arena&);
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>&);
+        T *allocate(std::size_t);
+        void deallocate(T*, std::size_t);
+        Arena *getArena() const;
+
+    private:
+        Arena *arena;
+};
+
+inline Arena::Arena(unsigned char *memory, std::size_t size){
+    buffer = memory;
+    capacity = size;
+    used = 0;
+    highWater = 0;
+    overflows = 0;
+    held = false;
+}
+
+//align must be a power of two
+inline void *Arena::allocate(std::size_t size, std::size_t align){
+    std::size_t start = (used + align - 1) & ~(align - 1);
+    if(start + size > capacity){
+        overflows++;
+        return ::operator new(size);
+    }
+    used = start + size;
+    highWater = used > highWater ? used : highWater;
+    return buffer + start;
+}
+
+inline bool Arena::owns(const void *pointer){
+    const unsigned char *p = static_cast<const unsigned char*>(pointer);
+    return p >= buffer && p < buffer + capacity;
+}
+
+//claims the arena and empties it, false if someone else has it
+inline bool Arena::acquire(){
+    bool expected = false;
+    if(!held.compare_exchange_strong(expected, true)){
+        return false;
+    }
+    used = 0;
+    return true;
+}
+
+inline void Arena::release(){
+    held = false;
+}
+
+//only once nothing allocated from it is used anymore, never while it's held
+inline void Arena::reset(){
+    assert(!held);
+    used = 0;
+}
+
+inline std::size_t Arena::getUsed(){
+    return used;
+}
+
+//most ever used between resets, to size the buffer
+inline std::size_t Arena::getHighWater(){
+    return highWater;
+}
+
+inline std::size_t Arena::getCapacity(){
+    return capacity;
+}
+
+inline std::uint32_t Arena::getOverflows(){
+    return overflows;
+}
+
+inline ArenaLease::ArenaLease(Arena &leased) : arena(leased){
+    held = arena.acquire();
+}
+
+inline ArenaLease::~ArenaLease(){
+    if(held){
+        arena.release();
+    }
+}
+
+//false if the arena was already taken, nothing may be allocated from it then
+inline bool ArenaLease::isHeld(){
+    return held;
+}
+
+template <std::size_t N>
+StaticArena<N>::StaticArena() : Arena(storage, N){}
+
+template <typename T>
+ArenaAllocator<T>::ArenaAllocator(Arena &source) : arena(&source){}
+
+template <typename T>
+template <typename U>
+ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.getArena()){}
+
+template <typename T>
+T *ArenaAllocator<T>::allocate(std::size_t n){
+    return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+}
+
+//arena memory comes back on reset, only an overflow went to the heap
+template <typename T>
+void ArenaAllocator<T>::deallocate(T *pointer, std::size_t){
+    if(!arena->owns(pointer)){
+        ::operator delete(pointer);
+    }
+}
+
+template <typename T>
+Arena *ArenaAllocator<T>::getArena() const{
+    return arena;
+}
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b){
+    return a.getArena() == b.getArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b){
+    return !(a == b);
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef ASYNCMOTION_HPP
+#define ASYNCMOTION_HPP
+
+#include <atomic>
+#include "main.h"
+
+//shared between the robot's motion task and anyone holding an AsyncMotion.
+//ids count up, a move is done once finished has caught up to its id
+struct MotionStatus{
+    std::atomic<std::uint32_t> issued{0};
+    std::atomic<std::uint32_t> finished{0};
+    std::atomic<double> progress{0};     //ft driven or degrees turned in the current move
+};
+
+//handle to a move running on the motion task, similar to okapi's
+//AsyncPositionController but for a single queued command
+class AsyncMotion{
+    public:
+        AsyncMotion(MotionStatus*, std::uint32_t);
+        bool isSettled();
+        void waitUntilSettled();
+        void waitUntil(double);
+
+    private:
+        MotionStatus *status;
+        std::uint32_t id;
+};
+
+inline AsyncMotion::AsyncMotion(MotionStatus *motionStatus, std::uint32_t motionId){
+    status = motionStatus;
+    id = motionId;
+}
+
+inline bool AsyncMotion::isSettled(){
+    return status->finished >= id;
+}
+
+inline void AsyncMotion::waitUntilSettled(){
+    while(!isSettled()){
+        pros::delay(10);
+    }
+}
+
+//block until the move has covered the given distance (ft for drives, degrees
+//for turns) or has finished, whichever comes first
+inline void AsyncMotion::waitUntil(double distance){
+    while(!isSettled() && fabs(status->progress) < fabs(distance)){
+        pros::delay(10);
+    }
+}
+
+#endif
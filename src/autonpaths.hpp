@@ -0,0 +1,603 @@
+//generated by sim/pathgen.cpp, don't edit. rebuild with make -C sim paths
+#ifndef AUTONPATHS_HPP
+#define AUTONPATHS_HPP
+
+#include "trajectory.hpp"
+
+//pickup: (0, 0, 0) (3, 0, 0)
+//1.1 ft/s, 6 ft/s^2, track width 1.0417 ft, 2.92 s
+constexpr TrajectorySegment pickupLeft[] = {
+    {0.01, 0.000000, -0.520833, 0.000000, 0.000000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.000300, -0.520833, 0.000300, 0.060000, 6.000000, 600.000000, 0.0000},
+    {0.01, 0.001200, -0.520833, 0.001200, 0.120000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.002700, -0.520833, 0.002700, 0.180000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.004800, -0.520833, 0.004800, 0.240000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.007500, -0.520833, 0.007500, 0.300000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.010800, -0.520833, 0.010800, 0.360000, 6.000000, -0.000000, 0.0000},
+    {0.01, 0.014700, -0.520833, 0.014700, 0.420000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.019200, -0.520833, 0.019200, 0.480000, 6.000000, -0.000000, 0.0000},
+    {0.01, 0.024300, -0.520833, 0.024300, 0.540000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.030000, -0.520833, 0.030000, 0.600000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.036300, -0.520833, 0.036300, 0.660000, 6.000000, -0.000000, 0.0000},
+    {0.01, 0.043200, -0.520833, 0.043200, 0.720000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.050700, -0.520833, 0.050700, 0.780000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.058800, -0.520833, 0.058800, 0.840000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.067500, -0.520833, 0.067500, 0.900000, 6.000000, -0.000000, 0.0000},
+    {0.01, 0.076800, -0.520833, 0.076800, 0.960000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.086700, -0.520833, 0.086700, 1.020000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.097141, -0.520833, 0.097141, 1.064976, 4.497606, -150.239413, 0.0000},
+    {0.01, 0.107991, -0.520833, 0.107991, 1.100000, 3.502394, -99.521173, 0.0000},
+    {0.01, 0.118991, -0.520833, 0.118991, 1.100000, 0.000000, -350.239413, 0.0000},
+    {0.01, 0.129991, -0.520833, 0.129991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.140991, -0.520833, 0.140991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.151991, -0.520833, 0.151991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.162991, -0.520833, 0.162991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.173991, -0.520833, 0.173991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.184991, -0.520833, 0.184991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.195991, -0.520833, 0.195991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.206991, -0.520833, 0.206991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.217991, -0.520833, 0.217991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.228991, -0.520833, 0.228991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.239991, -0.520833, 0.239991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.250991, -0.520833, 0.250991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.261991, -0.520833, 0.261991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.272991, -0.520833, 0.272991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.283991, -0.520833, 0.283991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.294991, -0.520833, 0.294991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.305991, -0.520833, 0.305991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.316991, -0.520833, 0.316991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.327991, -0.520833, 0.327991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.338991, -0.520833, 0.338991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.349991, -0.520833, 0.349991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.360991, -0.520833, 0.360991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.371991, -0.520833, 0.371991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.382991, -0.520833, 0.382991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.393991, -0.520833, 0.393991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.404991, -0.520833, 0.404991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.415991, -0.520833, 0.415991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.426991, -0.520833, 0.426991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.437991, -0.520833, 0.437991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.448991, -0.520833, 0.448991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.459991, -0.520833, 0.459991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.470991, -0.520833, 0.470991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.481991, -0.520833, 0.481991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.492991, -0.520833, 0.492991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.503991, -0.520833, 0.503991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.514991, -0.520833, 0.514991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.525991, -0.520833, 0.525991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.536991, -0.520833, 0.536991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.547991, -0.520833, 0.547991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.558991, -0.520833, 0.558991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.569991, -0.520833, 0.569991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.580991, -0.520833, 0.580991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.591991, -0.520833, 0.591991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.602991, -0.520833, 0.602991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.613991, -0.520833, 0.613991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.624991, -0.520833, 0.624991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.635991, -0.520833, 0.635991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.646991, -0.520833, 0.646991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.657991, -0.520833, 0.657991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.668991, -0.520833, 0.668991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.679991, -0.520833, 0.679991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.690991, -0.520833, 0.690991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.701991, -0.520833, 0.701991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.712991, -0.520833, 0.712991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.723991, -0.520833, 0.723991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.734991, -0.520833, 0.734991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.745991, -0.520833, 0.745991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.756991, -0.520833, 0.756991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.767991, -0.520833, 0.767991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.778991, -0.520833, 0.778991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.789991, -0.520833, 0.789991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.800991, -0.520833, 0.800991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.811991, -0.520833, 0.811991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.822991, -0.520833, 0.822991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.833991, -0.520833, 0.833991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.844991, -0.520833, 0.844991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.855991, -0.520833, 0.855991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.866991, -0.520833, 0.866991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.877991, -0.520833, 0.877991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.888991, -0.520833, 0.888991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.899991, -0.520833, 0.899991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.910991, -0.520833, 0.910991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.921991, -0.520833, 0.921991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.932991, -0.520833, 0.932991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.943991, -0.520833, 0.943991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.954991, -0.520833, 0.954991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.965991, -0.520833, 0.965991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.976991, -0.520833, 0.976991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.987991, -0.520833, 0.987991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.998991, -0.520833, 0.998991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.009991, -0.520833, 1.009991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.020991, -0.520833, 1.020991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.031991, -0.520833, 1.031991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.042991, -0.520833, 1.042991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.053991, -0.520833, 1.053991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.064991, -0.520833, 1.064991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.075991, -0.520833, 1.075991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.086991, -0.520833, 1.086991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.097991, -0.520833, 1.097991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.108991, -0.520833, 1.108991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.119991, -0.520833, 1.119991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.130991, -0.520833, 1.130991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.141991, -0.520833, 1.141991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.152991, -0.520833, 1.152991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.163991, -0.520833, 1.163991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.174991, -0.520833, 1.174991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.185991, -0.520833, 1.185991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.196991, -0.520833, 1.196991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.207991, -0.520833, 1.207991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.218991, -0.520833, 1.218991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.229991, -0.520833, 1.229991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.240991, -0.520833, 1.240991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.251991, -0.520833, 1.251991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.262991, -0.520833, 1.262991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.273991, -0.520833, 1.273991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.284991, -0.520833, 1.284991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.295991, -0.520833, 1.295991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.306991, -0.520833, 1.306991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.317991, -0.520833, 1.317991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.328991, -0.520833, 1.328991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.339991, -0.520833, 1.339991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.350991, -0.520833, 1.350991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.361991, -0.520833, 1.361991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.372991, -0.520833, 1.372991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.383991, -0.520833, 1.383991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.394991, -0.520833, 1.394991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.405991, -0.520833, 1.405991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.416991, -0.520833, 1.416991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.427991, -0.520833, 1.427991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.438991, -0.520833, 1.438991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.449991, -0.520833, 1.449991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.460991, -0.520833, 1.460991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.471991, -0.520833, 1.471991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.482991, -0.520833, 1.482991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.493991, -0.520833, 1.493991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.504991, -0.520833, 1.504991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.515991, -0.520833, 1.515991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.526991, -0.520833, 1.526991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.537991, -0.520833, 1.537991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.548991, -0.520833, 1.548991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.559991, -0.520833, 1.559991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.570991, -0.520833, 1.570991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.581991, -0.520833, 1.581991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.592991, -0.520833, 1.592991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.603991, -0.520833, 1.603991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.614991, -0.520833, 1.614991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.625991, -0.520833, 1.625991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.636991, -0.520833, 1.636991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.647991, -0.520833, 1.647991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.658991, -0.520833, 1.658991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.669991, -0.520833, 1.669991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.680991, -0.520833, 1.680991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.691991, -0.520833, 1.691991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.702991, -0.520833, 1.702991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.713991, -0.520833, 1.713991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.724991, -0.520833, 1.724991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.735991, -0.520833, 1.735991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.746991, -0.520833, 1.746991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.757991, -0.520833, 1.757991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.768991, -0.520833, 1.768991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.779991, -0.520833, 1.779991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.790991, -0.520833, 1.790991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.801991, -0.520833, 1.801991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.812991, -0.520833, 1.812991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.823991, -0.520833, 1.823991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.834991, -0.520833, 1.834991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.845991, -0.520833, 1.845991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.856991, -0.520833, 1.856991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.867991, -0.520833, 1.867991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.878991, -0.520833, 1.878991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.889991, -0.520833, 1.889991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.900991, -0.520833, 1.900991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.911991, -0.520833, 1.911991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.922991, -0.520833, 1.922991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.933991, -0.520833, 1.933991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.944991, -0.520833, 1.944991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.955991, -0.520833, 1.955991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.966991, -0.520833, 1.966991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.977991, -0.520833, 1.977991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.988991, -0.520833, 1.988991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.999991, -0.520833, 1.999991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.010991, -0.520833, 2.010991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.021991, -0.520833, 2.021991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.032991, -0.520833, 2.032991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.043991, -0.520833, 2.043991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.054991, -0.520833, 2.054991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.065991, -0.520833, 2.065991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.076991, -0.520833, 2.076991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.087991, -0.520833, 2.087991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.098991, -0.520833, 2.098991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.109991, -0.520833, 2.109991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.120991, -0.520833, 2.120991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.131991, -0.520833, 2.131991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.142991, -0.520833, 2.142991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.153991, -0.520833, 2.153991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.164991, -0.520833, 2.164991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.175991, -0.520833, 2.175991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.186991, -0.520833, 2.186991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.197991, -0.520833, 2.197991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.208991, -0.520833, 2.208991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.219991, -0.520833, 2.219991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.230991, -0.520833, 2.230991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.241991, -0.520833, 2.241991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.252991, -0.520833, 2.252991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.263991, -0.520833, 2.263991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.274991, -0.520833, 2.274991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.285991, -0.520833, 2.285991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.296991, -0.520833, 2.296991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.307991, -0.520833, 2.307991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.318991, -0.520833, 2.318991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.329991, -0.520833, 2.329991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.340991, -0.520833, 2.340991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.351991, -0.520833, 2.351991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.362991, -0.520833, 2.362991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.373991, -0.520833, 2.373991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.384991, -0.520833, 2.384991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.395991, -0.520833, 2.395991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.406991, -0.520833, 2.406991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.417991, -0.520833, 2.417991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.428991, -0.520833, 2.428991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.439991, -0.520833, 2.439991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.450991, -0.520833, 2.450991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.461991, -0.520833, 2.461991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.472991, -0.520833, 2.472991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.483991, -0.520833, 2.483991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.494991, -0.520833, 2.494991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.505991, -0.520833, 2.505991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.516991, -0.520833, 2.516991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.527991, -0.520833, 2.527991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.538991, -0.520833, 2.538991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.549991, -0.520833, 2.549991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.560991, -0.520833, 2.560991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.571991, -0.520833, 2.571991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.582991, -0.520833, 2.582991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.593991, -0.520833, 2.593991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.604991, -0.520833, 2.604991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.615991, -0.520833, 2.615991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.626991, -0.520833, 2.626991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.637991, -0.520833, 2.637991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.648991, -0.520833, 2.648991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.659991, -0.520833, 2.659991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.670991, -0.520833, 2.670991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.681991, -0.520833, 2.681991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.692991, -0.520833, 2.692991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.703991, -0.520833, 2.703991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.714991, -0.520833, 2.714991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.725991, -0.520833, 2.725991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.736991, -0.520833, 2.736991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.747991, -0.520833, 2.747991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.758991, -0.520833, 2.758991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.769991, -0.520833, 2.769991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.780991, -0.520833, 2.780991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.791991, -0.520833, 2.791991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.802991, -0.520833, 2.802991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.813991, -0.520833, 2.813991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.824991, -0.520833, 2.824991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.835991, -0.520833, 2.835991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.846991, -0.520833, 2.846991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.857991, -0.520833, 2.857991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.868991, -0.520833, 2.868991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.879991, -0.520833, 2.879991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.890991, -0.520833, 2.890991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.901872, -0.520833, 2.901872, 1.068761, -3.123916, -312.391611, 0.0000},
+    {0.01, 2.912353, -0.520833, 2.912353, 1.025553, -4.320753, -119.683650, 0.0000},
+    {0.01, 2.922309, -0.520833, 2.922309, 0.965553, -6.000000, -167.924738, 0.0000},
+    {0.01, 2.931664, -0.520833, 2.931664, 0.905553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.940420, -0.520833, 2.940420, 0.845553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.948575, -0.520833, 2.948575, 0.785553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.956131, -0.520833, 2.956131, 0.725553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.963087, -0.520833, 2.963087, 0.665553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.969442, -0.520833, 2.969442, 0.605553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.975198, -0.520833, 2.975198, 0.545553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.980353, -0.520833, 2.980353, 0.485553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.984909, -0.520833, 2.984909, 0.425553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.988864, -0.520833, 2.988864, 0.365553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.992220, -0.520833, 2.992220, 0.305553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.994975, -0.520833, 2.994975, 0.245553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.997131, -0.520833, 2.997131, 0.185553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.998686, -0.520833, 2.998686, 0.125553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.999642, -0.520833, 2.999642, 0.065553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.999997, -0.520833, 2.999997, 0.005553, -6.000000, -0.000000, 0.0000},
+    {0.01, 3.000000, -0.520833, 3.000000, 0.000000, -0.555331, 544.466873, 0.0000},
+};
+
+constexpr TrajectorySegment pickupRight[] = {
+    {0.01, 0.000000, 0.520833, 0.000000, 0.000000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.000300, 0.520833, 0.000300, 0.060000, 6.000000, 600.000000, 0.0000},
+    {0.01, 0.001200, 0.520833, 0.001200, 0.120000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.002700, 0.520833, 0.002700, 0.180000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.004800, 0.520833, 0.004800, 0.240000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.007500, 0.520833, 0.007500, 0.300000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.010800, 0.520833, 0.010800, 0.360000, 6.000000, -0.000000, 0.0000},
+    {0.01, 0.014700, 0.520833, 0.014700, 0.420000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.019200, 0.520833, 0.019200, 0.480000, 6.000000, -0.000000, 0.0000},
+    {0.01, 0.024300, 0.520833, 0.024300, 0.540000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.030000, 0.520833, 0.030000, 0.600000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.036300, 0.520833, 0.036300, 0.660000, 6.000000, -0.000000, 0.0000},
+    {0.01, 0.043200, 0.520833, 0.043200, 0.720000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.050700, 0.520833, 0.050700, 0.780000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.058800, 0.520833, 0.058800, 0.840000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.067500, 0.520833, 0.067500, 0.900000, 6.000000, -0.000000, 0.0000},
+    {0.01, 0.076800, 0.520833, 0.076800, 0.960000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.086700, 0.520833, 0.086700, 1.020000, 6.000000, 0.000000, 0.0000},
+    {0.01, 0.097141, 0.520833, 0.097141, 1.064976, 4.497606, -150.239413, 0.0000},
+    {0.01, 0.107991, 0.520833, 0.107991, 1.100000, 3.502394, -99.521173, 0.0000},
+    {0.01, 0.118991, 0.520833, 0.118991, 1.100000, 0.000000, -350.239413, 0.0000},
+    {0.01, 0.129991, 0.520833, 0.129991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.140991, 0.520833, 0.140991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.151991, 0.520833, 0.151991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.162991, 0.520833, 0.162991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.173991, 0.520833, 0.173991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.184991, 0.520833, 0.184991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.195991, 0.520833, 0.195991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.206991, 0.520833, 0.206991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.217991, 0.520833, 0.217991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.228991, 0.520833, 0.228991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.239991, 0.520833, 0.239991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.250991, 0.520833, 0.250991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.261991, 0.520833, 0.261991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.272991, 0.520833, 0.272991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.283991, 0.520833, 0.283991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.294991, 0.520833, 0.294991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.305991, 0.520833, 0.305991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.316991, 0.520833, 0.316991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.327991, 0.520833, 0.327991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.338991, 0.520833, 0.338991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.349991, 0.520833, 0.349991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.360991, 0.520833, 0.360991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.371991, 0.520833, 0.371991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.382991, 0.520833, 0.382991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.393991, 0.520833, 0.393991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.404991, 0.520833, 0.404991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.415991, 0.520833, 0.415991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.426991, 0.520833, 0.426991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.437991, 0.520833, 0.437991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.448991, 0.520833, 0.448991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.459991, 0.520833, 0.459991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.470991, 0.520833, 0.470991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.481991, 0.520833, 0.481991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.492991, 0.520833, 0.492991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.503991, 0.520833, 0.503991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.514991, 0.520833, 0.514991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.525991, 0.520833, 0.525991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.536991, 0.520833, 0.536991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.547991, 0.520833, 0.547991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.558991, 0.520833, 0.558991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.569991, 0.520833, 0.569991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.580991, 0.520833, 0.580991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.591991, 0.520833, 0.591991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.602991, 0.520833, 0.602991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.613991, 0.520833, 0.613991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.624991, 0.520833, 0.624991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.635991, 0.520833, 0.635991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.646991, 0.520833, 0.646991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.657991, 0.520833, 0.657991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.668991, 0.520833, 0.668991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.679991, 0.520833, 0.679991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.690991, 0.520833, 0.690991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.701991, 0.520833, 0.701991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.712991, 0.520833, 0.712991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.723991, 0.520833, 0.723991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.734991, 0.520833, 0.734991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.745991, 0.520833, 0.745991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.756991, 0.520833, 0.756991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.767991, 0.520833, 0.767991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.778991, 0.520833, 0.778991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.789991, 0.520833, 0.789991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.800991, 0.520833, 0.800991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.811991, 0.520833, 0.811991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.822991, 0.520833, 0.822991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.833991, 0.520833, 0.833991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.844991, 0.520833, 0.844991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.855991, 0.520833, 0.855991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.866991, 0.520833, 0.866991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.877991, 0.520833, 0.877991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.888991, 0.520833, 0.888991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.899991, 0.520833, 0.899991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.910991, 0.520833, 0.910991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.921991, 0.520833, 0.921991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.932991, 0.520833, 0.932991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.943991, 0.520833, 0.943991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.954991, 0.520833, 0.954991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.965991, 0.520833, 0.965991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.976991, 0.520833, 0.976991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.987991, 0.520833, 0.987991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 0.998991, 0.520833, 0.998991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.009991, 0.520833, 1.009991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.020991, 0.520833, 1.020991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.031991, 0.520833, 1.031991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.042991, 0.520833, 1.042991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.053991, 0.520833, 1.053991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.064991, 0.520833, 1.064991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.075991, 0.520833, 1.075991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.086991, 0.520833, 1.086991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.097991, 0.520833, 1.097991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.108991, 0.520833, 1.108991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.119991, 0.520833, 1.119991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.130991, 0.520833, 1.130991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.141991, 0.520833, 1.141991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.152991, 0.520833, 1.152991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.163991, 0.520833, 1.163991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.174991, 0.520833, 1.174991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.185991, 0.520833, 1.185991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.196991, 0.520833, 1.196991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.207991, 0.520833, 1.207991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.218991, 0.520833, 1.218991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.229991, 0.520833, 1.229991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.240991, 0.520833, 1.240991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.251991, 0.520833, 1.251991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.262991, 0.520833, 1.262991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.273991, 0.520833, 1.273991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.284991, 0.520833, 1.284991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.295991, 0.520833, 1.295991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.306991, 0.520833, 1.306991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.317991, 0.520833, 1.317991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.328991, 0.520833, 1.328991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.339991, 0.520833, 1.339991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.350991, 0.520833, 1.350991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.361991, 0.520833, 1.361991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.372991, 0.520833, 1.372991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.383991, 0.520833, 1.383991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.394991, 0.520833, 1.394991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.405991, 0.520833, 1.405991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.416991, 0.520833, 1.416991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.427991, 0.520833, 1.427991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.438991, 0.520833, 1.438991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.449991, 0.520833, 1.449991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.460991, 0.520833, 1.460991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.471991, 0.520833, 1.471991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.482991, 0.520833, 1.482991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.493991, 0.520833, 1.493991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.504991, 0.520833, 1.504991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.515991, 0.520833, 1.515991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.526991, 0.520833, 1.526991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.537991, 0.520833, 1.537991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.548991, 0.520833, 1.548991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.559991, 0.520833, 1.559991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.570991, 0.520833, 1.570991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.581991, 0.520833, 1.581991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.592991, 0.520833, 1.592991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.603991, 0.520833, 1.603991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.614991, 0.520833, 1.614991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.625991, 0.520833, 1.625991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.636991, 0.520833, 1.636991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.647991, 0.520833, 1.647991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.658991, 0.520833, 1.658991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.669991, 0.520833, 1.669991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.680991, 0.520833, 1.680991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.691991, 0.520833, 1.691991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.702991, 0.520833, 1.702991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.713991, 0.520833, 1.713991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.724991, 0.520833, 1.724991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.735991, 0.520833, 1.735991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.746991, 0.520833, 1.746991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.757991, 0.520833, 1.757991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.768991, 0.520833, 1.768991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.779991, 0.520833, 1.779991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.790991, 0.520833, 1.790991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.801991, 0.520833, 1.801991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.812991, 0.520833, 1.812991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.823991, 0.520833, 1.823991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.834991, 0.520833, 1.834991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.845991, 0.520833, 1.845991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.856991, 0.520833, 1.856991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.867991, 0.520833, 1.867991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.878991, 0.520833, 1.878991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.889991, 0.520833, 1.889991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.900991, 0.520833, 1.900991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.911991, 0.520833, 1.911991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.922991, 0.520833, 1.922991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.933991, 0.520833, 1.933991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.944991, 0.520833, 1.944991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.955991, 0.520833, 1.955991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.966991, 0.520833, 1.966991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.977991, 0.520833, 1.977991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.988991, 0.520833, 1.988991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 1.999991, 0.520833, 1.999991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.010991, 0.520833, 2.010991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.021991, 0.520833, 2.021991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.032991, 0.520833, 2.032991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.043991, 0.520833, 2.043991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.054991, 0.520833, 2.054991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.065991, 0.520833, 2.065991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.076991, 0.520833, 2.076991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.087991, 0.520833, 2.087991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.098991, 0.520833, 2.098991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.109991, 0.520833, 2.109991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.120991, 0.520833, 2.120991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.131991, 0.520833, 2.131991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.142991, 0.520833, 2.142991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.153991, 0.520833, 2.153991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.164991, 0.520833, 2.164991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.175991, 0.520833, 2.175991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.186991, 0.520833, 2.186991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.197991, 0.520833, 2.197991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.208991, 0.520833, 2.208991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.219991, 0.520833, 2.219991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.230991, 0.520833, 2.230991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.241991, 0.520833, 2.241991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.252991, 0.520833, 2.252991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.263991, 0.520833, 2.263991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.274991, 0.520833, 2.274991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.285991, 0.520833, 2.285991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.296991, 0.520833, 2.296991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.307991, 0.520833, 2.307991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.318991, 0.520833, 2.318991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.329991, 0.520833, 2.329991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.340991, 0.520833, 2.340991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.351991, 0.520833, 2.351991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.362991, 0.520833, 2.362991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.373991, 0.520833, 2.373991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.384991, 0.520833, 2.384991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.395991, 0.520833, 2.395991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.406991, 0.520833, 2.406991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.417991, 0.520833, 2.417991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.428991, 0.520833, 2.428991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.439991, 0.520833, 2.439991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.450991, 0.520833, 2.450991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.461991, 0.520833, 2.461991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.472991, 0.520833, 2.472991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.483991, 0.520833, 2.483991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.494991, 0.520833, 2.494991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.505991, 0.520833, 2.505991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.516991, 0.520833, 2.516991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.527991, 0.520833, 2.527991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.538991, 0.520833, 2.538991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.549991, 0.520833, 2.549991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.560991, 0.520833, 2.560991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.571991, 0.520833, 2.571991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.582991, 0.520833, 2.582991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.593991, 0.520833, 2.593991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.604991, 0.520833, 2.604991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.615991, 0.520833, 2.615991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.626991, 0.520833, 2.626991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.637991, 0.520833, 2.637991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.648991, 0.520833, 2.648991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.659991, 0.520833, 2.659991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.670991, 0.520833, 2.670991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.681991, 0.520833, 2.681991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.692991, 0.520833, 2.692991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.703991, 0.520833, 2.703991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.714991, 0.520833, 2.714991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.725991, 0.520833, 2.725991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.736991, 0.520833, 2.736991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.747991, 0.520833, 2.747991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.758991, 0.520833, 2.758991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.769991, 0.520833, 2.769991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.780991, 0.520833, 2.780991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.791991, 0.520833, 2.791991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.802991, 0.520833, 2.802991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.813991, 0.520833, 2.813991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.824991, 0.520833, 2.824991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.835991, 0.520833, 2.835991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.846991, 0.520833, 2.846991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.857991, 0.520833, 2.857991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.868991, 0.520833, 2.868991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.879991, 0.520833, 2.879991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.890991, 0.520833, 2.890991, 1.100000, 0.000000, 0.000000, 0.0000},
+    {0.01, 2.901872, 0.520833, 2.901872, 1.068761, -3.123916, -312.391611, 0.0000},
+    {0.01, 2.912353, 0.520833, 2.912353, 1.025553, -4.320753, -119.683650, 0.0000},
+    {0.01, 2.922309, 0.520833, 2.922309, 0.965553, -6.000000, -167.924738, 0.0000},
+    {0.01, 2.931664, 0.520833, 2.931664, 0.905553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.940420, 0.520833, 2.940420, 0.845553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.948575, 0.520833, 2.948575, 0.785553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.956131, 0.520833, 2.956131, 0.725553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.963087, 0.520833, 2.963087, 0.665553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.969442, 0.520833, 2.969442, 0.605553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.975198, 0.520833, 2.975198, 0.545553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.980353, 0.520833, 2.980353, 0.485553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.984909, 0.520833, 2.984909, 0.425553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.988864, 0.520833, 2.988864, 0.365553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.992220, 0.520833, 2.992220, 0.305553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.994975, 0.520833, 2.994975, 0.245553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.997131, 0.520833, 2.997131, 0.185553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.998686, 0.520833, 2.998686, 0.125553, -6.000000, -0.000000, 0.0000},
+    {0.01, 2.999642, 0.520833, 2.999642, 0.065553, -6.000000, 0.000000, 0.0000},
+    {0.01, 2.999997, 0.520833, 2.999997, 0.005553, -6.000000, -0.000000, 0.0000},
+    {0.01, 3.000000, 0.520833, 3.000000, 0.000000, -0.555331, 544.466873, 0.0000},
+};
+
+constexpr Trajectory pickupTrajectory = {pickupLeft, pickupRight, 293};
+
+#endif
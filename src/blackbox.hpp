@@ -0,0 +1,149 @@
+#ifndef BLACKBOX_HPP
+#define BLACKBOX_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "main.h"
+#include "ringbuffer.hpp"
+
+//bump whenever BlackBoxRecord changes, sim/bbdecode checks it
+#define BLACKBOX_VERSION 1
+
+//start of every log file, records follow back to back until the end
+struct __attribute__((packed)) BlackBoxFileHeader{
+    char magic[4];              //"BBOX"
+    std::uint16_t version;
+    std::uint16_t recordSize;   //sizeof(BlackBoxRecord)
+    std::uint32_t startTime;    //ms since the program started
+};
+
+//one control tick
+struct __attribute__((packed)) BlackBoxRecord{
+    std::uint32_t time;             //ms
+    std::uint8_t status;            //pros::competition::get_status()
+    std::int8_t axes[4];            //controller left x, left y, right x, right y
+    std::int16_t leftVoltage;       //mV commanded, left_drive1
+    std::int16_t rightVoltage;
+    float leftPosition;             //ft, average of the side's encoders
+    float rightPosition;
+    float rotation;                 //deg, imu
+    std::uint8_t temperature[8];    //C, in MotorOutput order
+};
+
+//flight recorder for matches. the sensor task pushes a record every control
+//tick into a bounded ring and a low priority task appends them to one file
+//per boot on the sd card. records are gathered into a fixed block in memory
+//and written a block at a time, with a flush every second so a brownout or a
+//pulled battery loses at most that much
+class BlackBox{
+    public:
+        BlackBox();
+        bool push(const BlackBoxRecord&);
+        bool start(std::string);
+        std::string getFileName();
+        std::uint32_t getWritten();
+        std::uint32_t getDropped();
+
+    private:
+        static const std::size_t blockSize = 4096;
+        static const std::uint32_t flushPeriod = 1000;  //ms
+        void writer();
+        void writeBlock();
+
+        RingBuffer<BlackBoxRecord, 256> ring;
+        std::uint8_t block[blockSize];
+        std::size_t blockUsed;
+        FILE *file;
+        std::string fileName;
+        pros::Task *task;
+        std::atomic<std::uint32_t> written;    //bumped by the writer task, read from anywhere
+};
+
+inline BlackBox::BlackBox(){
+    blockUsed = 0;
+    file = nullptr;
+    task = nullptr;
+    written = 0;
+}
+
+//never blocks, false if recording hasn't started or the ring was full
+inline bool BlackBox::push(const BlackBoxRecord &record){
+    return task != nullptr && ring.push(record);
+}
+
+//opens the next unused bbNNN.bin in the directory and starts the writer.
+//false if there's no room for another log or the file can't be created
+inline bool BlackBox::start(std::string directory){
+    if(task != nullptr){
+        return true;
+    }
+    for(int i = 0; i < 1000 && file == nullptr; i++){
+        char name[16];
+        std::snprintf(name, sizeof(name), "/bb%03d.bin", i);
+        FILE *existing = std::fopen((directory + name).c_str(), "rb");
+        if(existing != nullptr){
+            std::fclose(existing);
+            continue;
+        }
+        fileName = directory + name;
+        file = std::fopen(fileName.c_str(), "wb");
+        if(file == nullptr){
+            return false;
+        }
+    }
+    if(file == nullptr){
+        return false;
+    }
+
+    BlackBoxFileHeader header = {{'B', 'B', 'O', 'X'}, BLACKBOX_VERSION, sizeof(BlackBoxRecord), pros::millis()};
+    std::fwrite(&header, sizeof(header), 1, file);
+    std::fflush(file);
+    task = new pros::Task([this]{ writer(); }, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_DEFAULT, "blackbox");
+    return true;
+}
+
+inline void BlackBox::writer(){
+    std::uint32_t lastFlush = pros::millis();
+    while(true){
+        BlackBoxRecord record;
+        while(ring.pop(record)){
+            if(blockUsed + sizeof(record) > blockSize){
+                writeBlock();
+            }
+            std::memcpy(block + blockUsed, &record, sizeof(record));
+            blockUsed += sizeof(record);
+            written++;
+        }
+        if(pros::millis() - lastFlush >= flushPeriod){
+            writeBlock();
+            std::fflush(file);
+            lastFlush = pros::millis();
+        }
+        pros::delay(50);
+    }
+}
+
+inline void BlackBox::writeBlock(){
+    if(blockUsed > 0){
+        std::fwrite(block, 1, blockUsed, file);
+        blockUsed = 0;
+    }
+}
+
+//empty until start() has opened a file
+inline std::string BlackBox::getFileName(){
+    return fileName;
+}
+
+inline std::uint32_t BlackBox::getWritten(){
+    return written;
+}
+
+inline std::uint32_t BlackBox::getDropped(){
+    return ring.getDropped();
+}
+
+#endif
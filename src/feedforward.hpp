@@ -0,0 +1,86 @@
+#ifndef FEEDFORWARD_HPP
+#define FEEDFORWARD_HPP
+
+#include <math.h>
+#include <vector>
+
+//voltage one side of the drive needs to hold a velocity and acceleration:
+//kS * sign(v) + kV * v + kA * a. everything is in millivolts
+struct Feedforward{
+    double kS;  //mV to break static friction
+    double kV;  //mV per ft/s
+    double kA;  //mV per ft/s^2
+
+    double operator()(double velocity, double acceleration) const{
+        double voltage = kV * velocity + kA * acceleration;
+        if(velocity != 0){
+            voltage += velocity > 0 ? kS : -kS;
+        }
+        return voltage;
+    }
+};
+
+//one logged tick of a characterization run
+struct DriveSample{
+    double voltage;         //mV commanded
+    double velocity;        //ft/s measured
+    double acceleration;    //ft/s^2, differentiated from velocity
+};
+
+//least squares fit of kS, kV and kA to the samples. samples where the side
+//wasn't powered or hadn't started moving say nothing about the model and are
+//left out. returns false when there isn't enough spread in the data to solve
+inline bool fitFeedforward(const std::vector<DriveSample> &samples, Feedforward &result){
+    const double minVelocity = 0.05; //ft/s
+
+    //normal equations, A^T A x = A^T b with rows (sign(v), v, a)
+    double m[3][4] = {};
+    int used = 0;
+    for(const DriveSample &s : samples){
+        if(s.voltage == 0 || fabs(s.velocity) < minVelocity){
+            continue;
+        }
+        double row[3] = {s.velocity > 0 ? 1.0 : -1.0, s.velocity, s.acceleration};
+        for(int i = 0; i < 3; i++){
+            for(int j = 0; j < 3; j++){
+                m[i][j] += row[i] * row[j];
+            }
+            m[i][3] += row[i] * s.voltage;
+        }
+        used++;
+    }
+    if(used < 3){
+        return false;
+    }
+
+    //gaussian elimination with partial pivoting
+    for(int col = 0; col < 3; col++){
+        int pivot = col;
+        for(int r = col + 1; r < 3; r++){
+            if(fabs(m[r][col]) > fabs(m[pivot][col])){
+                pivot = r;
+            }
+        }
+        if(fabs(m[pivot][col]) < 1e-9){
+            return false;
+        }
+        for(int c = 0; c < 4; c++){
+            double t = m[col][c];
+            m[col][c] = m[pivot][c];
+            m[pivot][c] = t;
+        }
+        for(int r = 0; r < 3; r++){
+            if(r != col){
+                double f = m[r][col] / m[col][col];
+                for(int c = col; c < 4; c++){
+                    m[r][c] -= f * m[col][c];
+                }
+            }
+        }
+    }
+
+    result = {m[0][3] / m[0][0], m[1][3] / m[1][1], m[2][3] / m[2][2]};
+    return true;
+}
+
+#endif
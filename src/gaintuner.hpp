@@ -0,0 +1,128 @@
+#ifndef GAINTUNER_HPP
+#define GAINTUNER_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+#include "pid.hpp"
+
+//how well the last move went, filled in by the robot's move loops. the error
+//is taken as a fraction of the move, so a turn in degrees and a drive in feet
+//score on the same scale and one set of weights suits both
+struct MoveScore{
+    double itae;        //integral of time * |error| / move size over the move, s^2
+    double settleTime;  //s from the start of the move until it ended
+};
+
+//particle swarm search for pid gains, the same algorithm and defaults as
+//okapi's PIDTuner. okapi's version only drives its own IterativePosPIDController,
+//this one scores each candidate with a trial the caller runs on the robot's
+//real move loops, so it can tune any stage of any controller
+class GainTuner{
+    public:
+        GainTuner(std::function<MoveScore(PIDGains)>, PIDGains, PIDGains,
+                  std::size_t = 5, std::size_t = 16, double = 1, double = 2);
+        PIDGains autotune();
+
+    private:
+        static constexpr double inertia = 0.5;      //particle inertia
+        static constexpr double confSelf = 1.1;     //self confidence
+        static constexpr double confSwarm = 1.2;    //particle swarm confidence
+
+        struct Particle{
+            double pos, vel, best;
+        };
+        struct ParticleSet{
+            Particle kP, kI, kD;
+            double bestError;
+        };
+
+        double cost(PIDGains);
+        void move(Particle&, double, double, double, double);
+
+        std::function<MoveScore(PIDGains)> trial;
+        PIDGains min;
+        PIDGains max;
+        std::size_t numIterations;
+        std::size_t numParticles;
+        double kSettle;
+        double kITAE;
+        std::mt19937 random;
+};
+
+//min and max bound each gain, the trial runs one move with the given gains
+//and reports how it went
+inline GainTuner::GainTuner(std::function<MoveScore(PIDGains)> moveTrial, PIDGains minGains, PIDGains maxGains,
+                            std::size_t iterations, std::size_t particles, double settleWeight, double itaeWeight){
+    trial = moveTrial;
+    min = minGains;
+    max = maxGains;
+    numIterations = iterations;
+    numParticles = particles;
+    kSettle = settleWeight;
+    kITAE = itaeWeight;
+    random.seed(pros::millis());
+}
+
+inline double GainTuner::cost(PIDGains gains){
+    MoveScore score = trial(gains);
+    return kSettle * score.settleTime + kITAE * score.itae;
+}
+
+inline void GainTuner::move(Particle &particle, double globalBest, double lower, double upper, double span){
+    std::uniform_real_distribution<double> unit(0, 1);
+    particle.vel = inertia * particle.vel + confSelf * unit(random) * (particle.best - particle.pos) +
+                   confSwarm * unit(random) * (globalBest - particle.pos);
+    particle.vel = fmin(fmax(particle.vel, -span), span);
+    particle.pos = fmin(fmax(particle.pos + particle.vel, lower), upper);
+}
+
+//runs numIterations * numParticles trials and returns the best gains seen
+inline PIDGains GainTuner::autotune(){
+    std::uniform_real_distribution<double> unit(0, 1);
+    std::vector<ParticleSet> particles;
+    for(std::size_t i = 0; i < numParticles; i++){
+        ParticleSet set;
+        set.kP.pos = min.kP + unit(random) * (max.kP - min.kP);
+        set.kI.pos = min.kI + unit(random) * (max.kI - min.kI);
+        set.kD.pos = min.kD + unit(random) * (max.kD - min.kD);
+        set.kP.vel = set.kI.vel = set.kD.vel = 0;
+        set.kP.best = set.kP.pos;
+        set.kI.best = set.kI.pos;
+        set.kD.best = set.kD.pos;
+        set.bestError = INFINITY;
+        particles.push_back(set);
+    }
+
+    PIDGains best = {particles[0].kP.pos, particles[0].kI.pos, particles[0].kD.pos};
+    double bestError = INFINITY;
+    for(std::size_t iteration = 0; iteration < numIterations; iteration++){
+        for(ParticleSet &set : particles){
+            PIDGains gains = {set.kP.pos, set.kI.pos, set.kD.pos};
+            double error = cost(gains);
+            if(error < set.bestError){
+                set.bestError = error;
+                set.kP.best = set.kP.pos;
+                set.kI.best = set.kI.pos;
+                set.kD.best = set.kD.pos;
+            }
+            if(error < bestError){
+                bestError = error;
+                best = gains;
+            }
+        }
+        std::printf("autotune %d/%d: best kP %.4f kI %.4f kD %.4f cost %.3f\n", (int)iteration + 1,
+                    (int)numIterations, best.kP, best.kI, best.kD, bestError);
+
+        for(ParticleSet &set : particles){
+            move(set.kP, best.kP, min.kP, max.kP, max.kP - min.kP);
+            move(set.kI, best.kI, min.kI, max.kI, max.kI - min.kI);
+            move(set.kD, best.kD, min.kD, max.kD, max.kD - min.kD);
+        }
+    }
+    return best;
+}
+
+#endif
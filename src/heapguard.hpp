@@ -0,0 +1,77 @@
+#ifndef HEAPGUARD_HPP
+#define HEAPGUARD_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include "main.h"
+
+//watches for heap allocations once the robot is set up. everything that
+//needs memory should get it in initialize(), after lock() any operator new
+//is counted, and with trap set it stops the program right there so the
+//terminal or a debugger shows who asked. main.cpp routes the global
+//operator new and delete through allocate() and release().
+//only c++ allocation is seen, newlib's own malloc calls (fopen, printf of
+//doubles) go around it
+namespace heapguard{
+
+inline std::atomic<bool> locked(false);
+inline std::atomic<std::uint32_t> lateAllocations(0);
+inline bool trap = false;
+inline std::atomic<pros::task_t> unlockedTask(nullptr);   //see Unlocked
+
+//from the end of initialize()
+inline void lock(){
+    locked = true;
+}
+
+//allocations after lock()
+inline std::uint32_t getLateAllocations(){
+    return lateAllocations;
+}
+
+inline void *allocate(std::size_t size){
+    if(locked && pros::c::task_get_current() != unlockedTask){
+        lateAllocations++;
+        if(trap){
+            std::fprintf(stderr, "heap allocation of %u bytes after initialize()\n", (unsigned)size);
+            __builtin_trap();
+        }
+    }
+    void *pointer = std::malloc(size == 0 ? 1 : size);
+    if(pointer == nullptr){
+        std::abort();
+    }
+    return pointer;
+}
+
+inline void release(void *pointer){
+    std::free(pointer);
+}
+
+//lets a bench procedure like autotune() allocate while it runs, it isn't on
+//the match control path. only the task that made it is let off, every other
+//task is still watched. one task at a time, a nested one on the same task is
+//fine
+class Unlocked{
+    public:
+        Unlocked();
+        ~Unlocked();
+
+    private:
+        pros::task_t previous;
+};
+
+inline Unlocked::Unlocked(){
+    previous = unlockedTask.exchange(pros::c::task_get_current());
+}
+
+inline Unlocked::~Unlocked(){
+    unlockedTask = previous;
+}
+
+}
+
+#endif
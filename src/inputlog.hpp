@@ -0,0 +1,228 @@
+#ifndef INPUTLOG_HPP
+#define INPUTLOG_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "main.h"
+#include "ringbuffer.hpp"
+
+//bump whenever ControllerFrame changes
+#define INPUTLOG_VERSION 1
+
+//start of every input log, frames follow back to back until the end
+struct __attribute__((packed)) InputLogHeader{
+    char magic[4];              //"CTRL"
+    std::uint16_t version;
+    std::uint16_t frameSize;    //sizeof(ControllerFrame)
+};
+
+//everything opcontrol reads from the controller in one tick
+struct __attribute__((packed)) ControllerFrame{
+    std::uint32_t time;         //ms since the log started, only for reading the log
+    std::int8_t axes[4];        //left x, left y, right x, right y
+    std::uint16_t buttons;      //bit n is DIGITAL_L1 + n
+};
+
+//stands in for pros::Controller in opcontrol. the controller is read once per
+//tick in update() and every get_ call in that tick sees the same frame, which
+//can be recorded to a file or come from one instead. replay goes by tick and
+//not by time, so a log run through the same code in the sim gives the same
+//motor commands every time, and on the robot the same up to loop jitter.
+//when a replay runs out the live controller takes over
+class ControllerInput{
+    public:
+        ControllerInput(pros::controller_id_e_t);
+        bool record(std::string);
+        bool replay(std::string);
+        void update();
+        std::int32_t get_analog(pros::controller_analog_e_t);
+        std::int32_t get_digital(pros::controller_digital_e_t);
+        void getAxes(std::int8_t*);
+        std::int32_t rumble(const char*);
+        bool isReplaying();
+        std::uint32_t getReplayLength();
+        std::uint32_t getFrames();
+        std::uint32_t getDropped();
+
+    private:
+        void writer();
+        void publish();
+
+        pros::Controller controller;
+        ControllerFrame frame;
+        std::atomic<std::uint32_t> axes;    //frame.axes packed, for other tasks
+        std::uint32_t frames;
+        std::uint32_t startTime;
+
+        std::vector<ControllerFrame> replayFrames;
+        bool replaying;
+
+        RingBuffer<ControllerFrame, 64> ring;
+        FILE *file;
+        pros::Task *task;
+};
+
+inline ControllerInput::ControllerInput(pros::controller_id_e_t id) : controller(id){
+    frame = {};
+    axes = 0;
+    frames = 0;
+    startTime = pros::millis();
+    replaying = false;
+    file = nullptr;
+    task = nullptr;
+}
+
+//appends every frame to the next unused inNNN.bin in the directory, written
+//by a low priority task so the driver loop never waits on the card
+inline bool ControllerInput::record(std::string directory){
+    if(task != nullptr || replaying){
+        return false;
+    }
+    std::string fileName;
+    for(int i = 0; i < 1000 && file == nullptr; i++){
+        char name[16];
+        std::snprintf(name, sizeof(name), "/in%03d.bin", i);
+        FILE *existing = std::fopen((directory + name).c_str(), "rb");
+        if(existing != nullptr){
+            std::fclose(existing);
+            continue;
+        }
+        fileName = directory + name;
+        file = std::fopen(fileName.c_str(), "wb");
+        if(file == nullptr){
+            return false;
+        }
+    }
+    if(file == nullptr){
+        return false;
+    }
+
+    InputLogHeader header = {{'C', 'T', 'R', 'L'}, INPUTLOG_VERSION, sizeof(ControllerFrame)};
+    std::fwrite(&header, sizeof(header), 1, file);
+    std::fflush(file);
+    startTime = pros::millis();
+    task = new pros::Task([this]{ writer(); }, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_DEFAULT, "inputlog");
+    return true;
+}
+
+//reads a whole log up front so nothing touches the card while it plays.
+//false if the file is missing or from a different version
+inline bool ControllerInput::replay(std::string fileName){
+    FILE *in = std::fopen(fileName.c_str(), "rb");
+    if(in == nullptr){
+        return false;
+    }
+    InputLogHeader header;
+    if(std::fread(&header, sizeof(header), 1, in) != 1 || std::memcmp(header.magic, "CTRL", 4) != 0
+       || header.version != INPUTLOG_VERSION || header.frameSize != sizeof(ControllerFrame)){
+        std::fclose(in);
+        return false;
+    }
+    replayFrames.clear();
+    ControllerFrame next;
+    while(std::fread(&next, sizeof(next), 1, in) == 1){
+        replayFrames.push_back(next);
+    }
+    std::fclose(in);
+    replaying = true;
+    frames = 0;
+    return true;
+}
+
+//call once at the top of every tick
+inline void ControllerInput::update(){
+    if(replaying){
+        if(frames < replayFrames.size()){
+            frame = replayFrames[frames++];
+            publish();
+            return;
+        }
+        replaying = false;
+    }
+
+    frame.time = pros::millis() - startTime;
+    for(int i = 0; i < 4; i++){
+        frame.axes[i] = controller.get_analog((pros::controller_analog_e_t)i);
+    }
+    frame.buttons = 0;
+    for(int i = 0; i < 12; i++){
+        if(controller.get_digital((pros::controller_digital_e_t)(DIGITAL_L1 + i))){
+            frame.buttons |= 1 << i;
+        }
+    }
+    publish();
+    frames++;
+    if(task != nullptr){
+        ring.push(frame);
+    }
+}
+
+inline void ControllerInput::publish(){
+    std::uint32_t packed = 0;
+    for(int i = 0; i < 4; i++){
+        packed |= (std::uint32_t)(std::uint8_t)frame.axes[i] << (8 * i);
+    }
+    axes = packed;
+}
+
+inline std::int32_t ControllerInput::get_analog(pros::controller_analog_e_t channel){
+    return frame.axes[channel];
+}
+
+inline std::int32_t ControllerInput::get_digital(pros::controller_digital_e_t button){
+    return (frame.buttons >> (button - DIGITAL_L1)) & 1;
+}
+
+//the four axes of the last update(), safe to call from any task. the
+//get_ calls read frame directly and belong to the task that calls update()
+inline void ControllerInput::getAxes(std::int8_t *out){
+    std::uint32_t packed = axes;
+    for(int i = 0; i < 4; i++){
+        out[i] = (std::int8_t)(packed >> (8 * i));
+    }
+}
+
+//only the live controller can rumble, a replay has nobody holding it
+inline std::int32_t ControllerInput::rumble(const char *pattern){
+    return replaying ? 0 : controller.rumble(pattern);
+}
+
+inline void ControllerInput::writer(){
+    std::uint32_t lastFlush = pros::millis();
+    while(true){
+        ControllerFrame next;
+        while(ring.pop(next)){
+            std::fwrite(&next, sizeof(next), 1, file);
+        }
+        if(pros::millis() - lastFlush >= 1000){
+            std::fflush(file);
+            lastFlush = pros::millis();
+        }
+        pros::delay(100);
+    }
+}
+
+//true until the loaded log has been played through
+inline bool ControllerInput::isReplaying(){
+    return replaying;
+}
+
+//frames in the loaded log
+inline std::uint32_t ControllerInput::getReplayLength(){
+    return replayFrames.size();
+}
+
+//frames read from the controller or played back so far
+inline std::uint32_t ControllerInput::getFrames(){
+    return frames;
+}
+
+inline std::uint32_t ControllerInput::getDropped(){
+    return ring.getDropped();
+}
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef LOOPTIMER_HPP
+#define LOOPTIMER_HPP
+
+#include "main.h"
+#include "profiler.hpp"
+
+//fixed-period scheduler for control loops. uses task_delay_until so the period
+//stays constant no matter how long the loop body took, and keeps track of how
+//late each wakeup was (jitter) and how often the body ran past its deadline.
+//given a ProfileSection, every tick's busy time goes into it
+class LoopTimer{
+    public:
+        LoopTimer(std::uint32_t, ProfileSection* = nullptr);
+        void reset();
+        void wait();
+        void clearStats();
+        std::uint32_t getPeriod();
+        double getDt();
+        std::uint32_t getIterations();
+        std::uint32_t getOverruns();
+        std::uint32_t getLastJitter();
+        std::uint32_t getMaxJitter();
+        std::uint32_t getLastBusy();
+        std::uint32_t getMaxBusy();
+
+    private:
+        std::uint32_t period;
+        std::uint32_t prevTime;
+        std::uint32_t iterations;
+        std::uint32_t overruns;
+        std::uint32_t lastJitter;
+        std::uint32_t maxJitter;
+        std::uint32_t lastBusy;
+        std::uint32_t maxBusy;
+        ProfileSection *profile;
+};
+
+inline LoopTimer::LoopTimer(std::uint32_t periodMs, ProfileSection *tickProfile){
+    period = periodMs;
+    prevTime = 0;
+    profile = tickProfile;
+    clearStats();
+}
+
+//restart the schedule from now, call right before entering a loop
+inline void LoopTimer::reset(){
+    prevTime = pros::millis();
+}
+
+//sleep until the start of the next period
+inline void LoopTimer::wait(){
+    std::uint32_t now = pros::millis();
+    lastBusy = now - prevTime;
+    maxBusy = lastBusy > maxBusy ? lastBusy : maxBusy;
+    iterations++;
+    if(profile != nullptr){
+        profile->add(lastBusy);
+    }
+
+    if(lastBusy >= period){
+        //the body blew through its deadline. delay_until would return
+        //immediately and then burst to catch up, so drop the missed ticks
+        //and start the next period right now instead
+        overruns++;
+        lastJitter = lastBusy - period;
+        prevTime = now;
+    }else{
+        pros::Task::delay_until(&prevTime, period);
+        std::uint32_t woke = pros::millis();
+        lastJitter = woke - prevTime;
+    }
+    maxJitter = lastJitter > maxJitter ? lastJitter : maxJitter;
+}
+
+inline void LoopTimer::clearStats(){
+    iterations = 0;
+    overruns = 0;
+    lastJitter = 0;
+    maxJitter = 0;
+    lastBusy = 0;
+    maxBusy = 0;
+}
+
+inline std::uint32_t LoopTimer::getPeriod(){
+    return period;
+}
+
+//loop period in seconds, what the controllers should use as dt
+inline double LoopTimer::getDt(){
+    return period / 1000.0;
+}
+
+inline std::uint32_t LoopTimer::getIterations(){
+    return iterations;
+}
+
+inline std::uint32_t LoopTimer::getOverruns(){
+    return overruns;
+}
+
+inline std::uint32_t LoopTimer::getLastJitter(){
+    return lastJitter;
+}
+
+inline std::uint32_t LoopTimer::getMaxJitter(){
+    return maxJitter;
+}
+
+inline std::uint32_t LoopTimer::getLastBusy(){
+    return lastBusy;
+}
+
+inline std::uint32_t LoopTimer::getMaxBusy(){
+    return maxBusy;
+}
+
+#endif
@@ -1,8 +1,108 @@
 #include "main.h"
 #include "selection.h"
 #include "robot.hpp"
+#include "autonpaths.hpp"
+#include "inputlog.hpp"
+#include "statusdisplay.hpp"
+#include "heapguard.hpp"
+
+//every c++ allocation goes through heapguard, which counts the ones after
+//initialize() and with heapguard::trap set stops on them
+void *operator new(std::size_t size) {
+	return heapguard::allocate(size);
+}
+
+void *operator new[](std::size_t size) {
+	return heapguard::allocate(size);
+}
+
+void operator delete(void *pointer) noexcept {
+	heapguard::release(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+	heapguard::release(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+	heapguard::release(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+	heapguard::release(pointer);
+}
+
+Robot robot(19600, 31250, 5); //mV per second up and down, stick deadband
+
+//when filled in before autonomous() runs (from the sim or a test), the robot
+//follows these waypoints with pure pursuit instead of the precomputed pickup
+//trajectory
+std::vector<Waypoint> autonPath;
+
+//where robot.telemetry streams, the usb serial port unless the sim changes it
+FILE *telemetryStream = stdout;
+
+//match logs from robot.blackbox go here, one file per boot
+std::string logDirectory = "/usd";
+
+//gains found by autotune(), loaded over the defaults at boot when present
+std::string gainsFile = "/usd/gains.txt";
+
+//what opcontrol() drives from. with a card in, every tick of driver control
+//is recorded to an inNNN.bin next to the blackbox logs
+ControllerInput driverInput(pros::E_CONTROLLER_MASTER);
+
+//copy a recorded inNNN.bin here and hold A on the controller while the
+//program starts, opcontrol() then drives the log back before handing the
+//controller to the driver. never with field control connected
+std::string replayFile = "/usd/replay.bin";
+
+//arms the replay without the button, for the sim
+bool replayRequested = false;
+
+//one sample per opcontrol() tick, and per screen redraw
+ProfileSection driverTickProfile("driver tick");
+ProfileSection lcdProfile("lcd");
+
+//driver control screen, drawn by statusDisplay's task from what opcontrol() posts
+void showStatus(const DriverStatus &status) {
+	ScopedTimer timer(lcdProfile);
+	pros::lcd::print(0, "telemetry %d sent, %d dropped",
+		(int)robot.telemetry.getSent(), (int)robot.telemetry.getDropped());
+	pros::lcd::print(1, "%f", status.sensors.leftDistance);
+	pros::lcd::print(2, "%f", status.sensors.rotation);
+	pros::lcd::print(3, "loop %dms busy, %d overruns, %dms max jitter",
+		(int)status.maxBusy, (int)status.overruns, (int)status.maxJitter);
+	pros::lcd::print(4, "turn %d overruns, drive %d overruns",
+		(int)robot.turnLoop.getOverruns(), (int)robot.driveLoop.getOverruns());
+	Pose pose = robot.getPose();
+	pros::lcd::print(5, "x %.2f ft, y %.2f ft, %.1f deg", pose.x, pose.y, pose.theta);
+	pros::lcd::print(6, "motor writes %d, %d unchanged skipped",
+		(int)robot.output.getWrites(), (int)robot.output.getSkips());
+}
+
+//statusDisplay alerts
+const std::uint32_t ALERT_RUMBLE = 1;      //front limit switch closed
+const std::uint32_t ALERT_PROFILE = 2;     //write the section timings out
+
+//section timings go to the sd card when there is one, the terminal otherwise
+std::string profileFile = "/usd/profile.txt";
+
+void handleAlert(std::uint32_t alerts) {
+	if(alerts & ALERT_RUMBLE){
+		driverInput.rumble("-");
+	}
+	if(alerts & ALERT_PROFILE){
+		FILE *out = pros::usd::is_installed() ? fopen(profileFile.c_str(), "w") : nullptr;
+		ProfileSection::dumpAll(out != nullptr ? out : stdout);
+		if(out != nullptr){
+			fclose(out);
+		}
+	}
+}
 
-Robot robot(5, 8, 5);
+//10 updates a second
+StatusDisplay statusDisplay(showStatus, handleAlert, 100);
 
 /**
  * Runs initialization code. This occurs as soon as the program is started.
@@ -12,7 +112,23 @@ Robot robot(5, 8, 5);
  */
 void initialize() {
 	robot.initialize();
+	robot.setInput(&driverInput);
+	if(pros::usd::is_installed()){
+		robot.loadGains(gainsFile);
+		robot.blackbox.start(logDirectory);
+	}
+	bool onField = pros::competition::get_status() & COMPETITION_CONNECTED;
+	bool replayArmed = !onField && (replayRequested || robot.controller.get_digital(DIGITAL_A));
+	if((!replayArmed || !driverInput.replay(replayFile)) && pros::usd::is_installed()){
+		driverInput.record(logDirectory);
+	}
+	robot.telemetry.start(telemetryStream);
+	statusDisplay.start();
 	selectorInit();
+
+	//everything from here on runs on what was set up above. set
+	//heapguard::trap on a practice build to find anything that still allocates
+	heapguard::lock();
 }
 
 /**
@@ -20,7 +136,13 @@ void initialize() {
  * the VEX Competition Switch, following either autonomous or opcontrol. When
  * the robot is enabled, this task will exit.
  */
-void disabled() {}
+void disabled() {
+	//the brain cuts every motor while disabled, so whatever was last sent
+	//isn't what they're doing when the next mode starts
+	robot.output.invalidate();
+	//an async move outlives the autonomous task, don't let it carry on
+	robot.stop();
+}
 
 /**
  * Runs after initialize(), and before autonomous when connected to the Field
@@ -48,31 +170,91 @@ void competition_initialize() {
  * from where it left off.
  */
 
+//searches for turn and drive gains on the real move loops and saves the best
+//to the sd card. the robot turns back and forth in place, then drives back
+//and forth 2 ft, so give it room. each stage is tuned on its own with the
+//others held where they are, the wide one first since it sets up the approach
+void autotune() {
+	heapguard::Unlocked unlocked;
+	double home = robot.getRotation();
+	bool out = true;
+	auto turnTrial = [&](std::size_t stage){
+		return [&, stage](PIDGains gains){
+			robot.turnPID.setGains(stage, gains);
+			robot.turn(out ? home + 90 : home);
+			out = !out;
+			return robot.getLastScore();
+		};
+	};
+	std::size_t last = robot.turnPID.getStageCount() - 1;
+	robot.turnPID.setGains(last, GainTuner(turnTrial(last), {95, 0, 0}, {570, 0, 1900}, 4, 10).autotune());
+	robot.turnPID.setGains(0, GainTuner(turnTrial(0), {190, 0, 0}, {950, 19, 1900}, 4, 10).autotune());
+	if(!out){
+		robot.turn(home);
+	}
+
+	GainTuner driveTuner([&](PIDGains gains){
+		robot.driveGains = gains;
+		robot.driveSProfile(out ? 2 : -2);
+		out = !out;
+		return robot.getLastScore();
+	}, {1900, 0, 0}, {15000, 190, 19000}, 4, 10);
+	robot.driveGains = driveTuner.autotune();
+	if(!out){
+		robot.driveSProfile(-2);
+	}
+
+	if(pros::usd::is_installed() && robot.saveGains(gainsFile)){
+		pros::lcd::print(7, "gains saved to %s", gainsFile.c_str());
+	}else{
+		pros::lcd::print(7, "no sd card, gains not saved");
+	}
+}
+
 void autonomous() {
+	//the last mode's task may have been deleted mid batch on this same handle
+	robot.output.invalidate();
 	if(abs(autonSelection) == 3){
 		return;
 	}
+	if(autonSelection == 4){
+		autotune();
+		return;
+	}
+	if(autonSelection == 5){
+		if(robot.characterize() && pros::usd::is_installed()){
+			robot.saveGains(gainsFile);
+		}
+		return;
+	}
 
 	//begin intake
-	robot.setIntakeSpeed(127);
+	robot.setIntakeVoltage(12000);
 
-	robot.drive(.5, 30);
-	robot.turn(0);
-	robot.drive(2.5, 30);
+	//pick up the first stack in one continuous move along the starting line
+	if(autonPath.empty()){
+		robot.followTrajectory(pickupTrajectory);
+	}else{
+		robot.followPath(autonPath, 2800);
+	}
 	pros::delay(300);
-	robot.drive(.5, -30);
+	robot.drive(.5, -2800);
 
+	//curve straight to the goal instead of turning and then driving. the
+	//pose is where turn(+-147) and drive(2) used to end up, relative to
+	//where the robot sat when odometry started in initialize()
 	if(autonSelection < 0){
-		robot.turn(147);
+		robot.driveToPoseAsync(.82, 1.09, 147, 6800);
 	}else if(autonSelection > 0){
-		robot.turn(-147);
+		robot.driveToPoseAsync(.82, -1.09, -147, 6800);
+	}else{
+		robot.driveAsync(2, 6800);
 	}
+	//back the intake off while the robot is still moving
+	robot.setIntakeVoltage(-950);
+	robot.waitUntilSettled();
 
-	robot.setIntakeSpeed(-10);
-
-	robot.drive(2, 72);
-
-	robot.setIntakeSpeed(0);
+	robot.setIntakeVoltage(0);
 /*
 	while(robot.tray.get_raw_position(NULL) < 3300){
 		int speed = scale(robot.tray.get_raw_position(NULL), 1200, 3400, 128, 11);
@@ -224,8 +406,12 @@ void autonomous() {
  */
 
 void opcontrol() {
-	pros::Controller master(pros::E_CONTROLLER_MASTER);
+	ControllerInput &master = driverInput;
 	pros::lcd::initialize();
+	//the last mode's task may have been deleted mid batch on this same handle
+	robot.output.invalidate();
+	//the driver has the robot from here, end anything autonomous left running
+	robot.stop();
 
 	bool tank{false};
 	int lastLimit = 0;
@@ -233,58 +419,83 @@ void opcontrol() {
 
 	bool wasR1Pressed = false;
 	bool wasR2Pressed = false;
+	bool wasYPressed = false;
+
+	//the driver loop runs at 100Hz above every default priority task. it
+	//only reads input and sets motors, the screen and rumble are handed to
+	//statusDisplay and logging to the blackbox and telemetry tasks, all at
+	//the lowest priority, and sensing has its own task above this one
+	pros::Task::current().set_priority(TASK_PRIORITY_DEFAULT + 1);
+	LoopTimer loop(10, &driverTickProfile);
+	loop.reset();
+	//start every channel from rest so a replay begins where its recording did
+	robot.leftSlew.reset();
+	robot.rightSlew.reset();
+	robot.intakeSlew.reset();
+	robot.rollerSlew.reset();
 	while (true) {
-		pros::lcd::print(1, "%f", robot.left_drive1.get_position());
-		//pros::lcd::print(2, "%d", robot.tray.get_raw_position(NULL));
-		//pros::lcd::print(3, "%d", robot.lift.get_raw_position(NULL));
-		//pros::lcd::print(5, "%d", robot.rear_ultrasonic.get_value());
-		pros::lcd::print(2, "%f", robot.imu.get_rotation());
-
-		if(robot.front_limitswitch.get_value() == 1 && lastLimit == 0){
-			master.rumble("-");
+		master.update();
+		SensorState sensors = robot.getSensors();
+		statusDisplay.post({sensors, loop.getMaxBusy(), loop.getOverruns(), loop.getMaxJitter()});
+
+		if(sensors.frontLimit && lastLimit == 0){
+			statusDisplay.alert(ALERT_RUMBLE);
 			lastLimit = 1;
-		}else if(robot.front_limitswitch.get_value() == 0){
+		}else if(!sensors.frontLimit){
 			lastLimit = 0;
 		}
 
+		//Y dumps the section timings without stopping the loop
+		if(master.get_digital(DIGITAL_Y) && !wasYPressed){
+			statusDisplay.alert(ALERT_PROFILE);
+		}
+		wasYPressed = master.get_digital(DIGITAL_Y);
+
 		if(master.get_digital(DIGITAL_X)){
 			tank = false;
 		}else if(master.get_digital(DIGITAL_B)){
 			tank = true;
 		}
 
-		if(tank){
-			robot.tankDrive(master.get_analog(ANALOG_LEFT_Y), master.get_analog(ANALOG_RIGHT_Y), false);
-		}else{
-			robot.arcadeDrive(master.get_analog(ANALOG_RIGHT_Y), master.get_analog(ANALOG_LEFT_X), false);
+		//driver profiles for the arcade stick response
+		if(master.get_digital(DIGITAL_UP)){
+			robot.setDriveCurve(cubicCurve);
+		}else if(master.get_digital(DIGITAL_DOWN)){
+			robot.setDriveCurve(preciseCurve);
+		}else if(master.get_digital(DIGITAL_LEFT)){
+			robot.setDriveCurve(exponentialCurve);
 		}
 
-		if(master.get_digital(DIGITAL_L1)){
-			robot.setIntakeSpeed(127);
-		}else if(master.get_digital(DIGITAL_L2)){
-			robot.setIntakeSpeed(-90);
-		}else{
-			robot.setIntakeSpeed(0);
-		}
+		//every motor command for this tick goes out together when the
+		//batch closes, before the loop sleeps
+		{
+			MotorBatch batch(robot.output);
 
-		//roller logic
-		int roller_state = 0;
-		if(master.get_digital(DIGITAL_R1)){
-			roller_state++;
-		}
-		if(master.get_digital(DIGITAL_R2)){
-			roller_state--;
-		}
+			if(tank){
+				robot.tankDrive(master.get_analog(ANALOG_LEFT_Y), master.get_analog(ANALOG_RIGHT_Y), false);
+			}else{
+				robot.arcadeDrive(master.get_analog(ANALOG_RIGHT_Y), master.get_analog(ANALOG_LEFT_X), false);
+			}
+
+			int intake = 0;
+			if(master.get_digital(DIGITAL_L1)){
+				intake = 12000;
+			}else if(master.get_digital(DIGITAL_L2)){
+				intake = -8500;
+			}
+			robot.setIntakeVoltage(robot.intakeSlew.step(intake));
+
+			//roller logic
+			int roller_state = 0;
+			if(master.get_digital(DIGITAL_R1)){
+				roller_state++;
+			}
+			if(master.get_digital(DIGITAL_R2)){
+				roller_state--;
+			}
 
-		switch(roller_state){
-			case 1:
-				robot.setRollerSpeed(127, 127);
-				break;
-			case -1:
-				robot.setRollerSpeed(-127, -127);
-				break;
-			default:
-			 	robot.setRollerSpeed(0, 0);
+			int roller = robot.rollerSlew.step(roller_state * 12000);
+			robot.setRollerVoltage(roller, roller);
 		}
 
 		//old competition code
@@ -325,6 +536,6 @@ void opcontrol() {
 			robot.forceLimitMotor(robot.tray, 0, 100, trayLowerLimit, trayUpperLimit);
 			pros::lcd::print(4, "%d, %d", trayLowerLimit, trayUpperLimit);
 		}*/
-		pros::delay(24);
+		loop.wait();
 	}
 }
@@ -0,0 +1,197 @@
+#ifndef MOTIONPROFILE_HPP
+#define MOTIONPROFILE_HPP
+
+#include <math.h>
+#include "utility.hpp"
+
+//shape of the speed up and slow down ramps. every shape is symmetric about
+//half the cruise velocity, so a ramp up to v over time t always covers v*t/2
+enum class ProfileShape{
+    trapezoid,  //constant acceleration, jerk unlimited
+    sCurve,     //acceleration ramps in and out at the jerk limit
+    sine        //velocity follows half a cosine wave (sinusoidal_s_curve)
+};
+
+struct ProfileLimits{
+    double velocity;        //units/s
+    double acceleration;    //units/s^2
+    double jerk;            //units/s^3, only used by sCurve
+};
+
+struct ProfileState{
+    double position;
+    double velocity;
+    double acceleration;
+};
+
+//time parameterized straight line profile from 0 to distance. when the
+//distance is too short to reach the velocity limit the cruise velocity is
+//lowered until the two ramps meet
+class MotionProfile{
+    public:
+        MotionProfile(double, ProfileLimits, ProfileShape);
+        ProfileState get(double);
+        double getDuration();
+        double getDistance();
+        double getCruiseVelocity();
+
+    private:
+        double rampTime(double);
+        ProfileState ramp(double);
+
+        double distance;
+        double direction;
+        ProfileLimits limits;
+        ProfileShape shape;
+        double cruiseVelocity;
+        double rampDuration;
+        double jerkDuration;
+        double peakAcceleration;
+        double duration;
+};
+
+inline MotionProfile::MotionProfile(double dist, ProfileLimits lim, ProfileShape profileShape){
+    direction = dist < 0 ? -1 : 1;
+    distance = fabs(dist);
+    limits = lim;
+    shape = profileShape;
+
+    //the two ramps to and from v cover v * rampTime(v), which grows with v, so
+    //bisect for the fastest cruise velocity that still fits in the distance
+    cruiseVelocity = limits.velocity;
+    if(cruiseVelocity * rampTime(cruiseVelocity) > distance){
+        double low = 0;
+        double high = limits.velocity;
+        for(int i = 0; i < 50; i++){
+            double mid = (low + high) / 2;
+            if(mid * rampTime(mid) > distance){
+                high = mid;
+            }else{
+                low = mid;
+            }
+        }
+        cruiseVelocity = low;
+    }
+
+    rampDuration = rampTime(cruiseVelocity);
+    if(shape == ProfileShape::sCurve){
+        double jerkToFull = limits.acceleration / limits.jerk;
+        if(cruiseVelocity >= limits.acceleration * jerkToFull){
+            jerkDuration = jerkToFull;
+            peakAcceleration = limits.acceleration;
+        }else{
+            //never reaches full acceleration, the ramp is two jerk phases
+            jerkDuration = sqrt(cruiseVelocity / limits.jerk);
+            peakAcceleration = limits.jerk * jerkDuration;
+        }
+    }else{
+        jerkDuration = 0;
+        peakAcceleration = limits.acceleration;
+    }
+
+    double cruiseTime = cruiseVelocity > 0 ? (distance - cruiseVelocity * rampDuration) / cruiseVelocity : 0;
+    duration = 2 * rampDuration + fmax(cruiseTime, 0);
+}
+
+//time to ramp from rest up to velocity v
+inline double MotionProfile::rampTime(double v){
+    switch(shape){
+        case ProfileShape::sCurve:
+            if(v >= limits.acceleration * limits.acceleration / limits.jerk){
+                return v / limits.acceleration + limits.acceleration / limits.jerk;
+            }
+            return 2 * sqrt(v / limits.jerk);
+        case ProfileShape::sine:
+            //peak acceleration of the half cosine is v * pi / (2 * t)
+            return v * M_PI / (2 * limits.acceleration);
+        default:
+            return v / limits.acceleration;
+    }
+}
+
+//state t seconds into the speed up ramp
+inline ProfileState MotionProfile::ramp(double t){
+    ProfileState state;
+    double v = cruiseVelocity;
+    double T = rampDuration;
+    switch(shape){
+        case ProfileShape::sCurve: {
+            double j = limits.jerk;
+            double tj = jerkDuration;
+            double a = peakAcceleration;
+            double tc = T - 2 * tj;
+            //end of the jerk up phase
+            double v1 = j * tj * tj / 2;
+            double p1 = j * tj * tj * tj / 6;
+            //end of the constant acceleration phase
+            double v2 = v1 + a * tc;
+            double p2 = p1 + v1 * tc + a * tc * tc / 2;
+            if(t < tj){
+                state.acceleration = j * t;
+                state.velocity = j * t * t / 2;
+                state.position = j * t * t * t / 6;
+            }else if(t < tj + tc){
+                double s = t - tj;
+                state.acceleration = a;
+                state.velocity = v1 + a * s;
+                state.position = p1 + v1 * s + a * s * s / 2;
+            }else{
+                double s = t - tj - tc;
+                state.acceleration = a - j * s;
+                state.velocity = v2 + a * s - j * s * s / 2;
+                state.position = p2 + v2 * s + a * s * s / 2 - j * s * s * s / 6;
+            }
+            break;
+        }
+        case ProfileShape::sine:
+            state.velocity = sinusoidal_s_curve(T, v, false, t);
+            state.acceleration = v * M_PI / (2 * T) * sin(M_PI * t / T);
+            state.position = v / 2 * (t - T / M_PI * sin(M_PI * t / T));
+            break;
+        default:
+            state.acceleration = peakAcceleration;
+            state.velocity = peakAcceleration * t;
+            state.position = peakAcceleration * t * t / 2;
+    }
+    return state;
+}
+
+//setpoint t seconds after the start of the move
+inline ProfileState MotionProfile::get(double t){
+    ProfileState state;
+    if(t <= 0){
+        state = {0, 0, 0};
+    }else if(t >= duration){
+        state = {distance, 0, 0};
+    }else if(t < rampDuration){
+        state = ramp(t);
+    }else if(t <= duration - rampDuration){
+        state.position = cruiseVelocity * rampDuration / 2 + cruiseVelocity * (t - rampDuration);
+        state.velocity = cruiseVelocity;
+        state.acceleration = 0;
+    }else{
+        //the slow down ramp is the speed up ramp played backwards
+        ProfileState mirror = ramp(duration - t);
+        state.position = distance - mirror.position;
+        state.velocity = mirror.velocity;
+        state.acceleration = -mirror.acceleration;
+    }
+    state.position *= direction;
+    state.velocity *= direction;
+    state.acceleration *= direction;
+    return state;
+}
+
+inline double MotionProfile::getDuration(){
+    return duration;
+}
+
+inline double MotionProfile::getDistance(){
+    return distance * direction;
+}
+
+inline double MotionProfile::getCruiseVelocity(){
+    return cruiseVelocity * direction;
+}
+
+#endif
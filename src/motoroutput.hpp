@@ -0,0 +1,295 @@
+#ifndef MOTOROUTPUT_HPP
+#define MOTOROUTPUT_HPP
+
+#include <atomic>
+#include <cstdint>
+#include "main.h"
+
+//output stage for the robot's motors, in millivolts through move_voltage()
+//rather than move()'s 127 steps. set() only records a motor's target, the
+//commands go out together in the order the motors were added, and a port
+//whose target hasn't changed since it was last written is skipped. outside a
+//batch each set() is written straight away; inside one, the task that opened
+//it holds its writes back until the batch closes.
+//the opcontrol, motion and autonomous tasks all write through the same
+//output, and the kernel deletes the competition tasks wherever they are when
+//the mode changes. so nothing is held while a batch is open: each task's
+//batch collects its targets in a slot of its own, and only the short write
+//that publishes them is locked. a slot or the lock left behind by a deleted
+//task is taken back once it has been stuck for staleTime
+class MotorOutput{
+    public:
+        MotorOutput();
+        void add(pros::Motor*);
+        void set(pros::Motor&, int);
+        int getTarget(pros::Motor&);
+        void flush();
+        void beginBatch();
+        void endBatch();
+        void invalidate();
+        std::uint32_t getWrites();
+        std::uint32_t getSkips();
+        std::uint32_t getRecoveries();
+
+    private:
+        static const int maxMotors = 8;
+        static const int maxBatches = 4;            //tasks with a batch open at once
+        static const std::uint32_t staleTime = 50;  //ms, far longer than any batch or write
+
+        //one task's open batch
+        struct Batch{
+            std::atomic<pros::task_t> task;
+            std::atomic<std::uint32_t> opened;  //ms
+            int depth;
+            int targets[maxMotors];
+            std::uint32_t pending;              //bit per motor set since the batch opened
+        };
+
+        Batch *findBatch();
+        void lock();
+        void unlock();
+        void write(int);
+
+        pros::Motor *motors[maxMotors];
+        std::atomic<int> targets[maxMotors];
+        std::atomic<bool> dirty[maxMotors];
+        int sent[maxMotors];            //these and the counts below only under lock()
+        bool written[maxMotors];
+        int count;
+        Batch batches[maxBatches];
+        std::atomic<pros::task_t> holder;   //of lock(), nullptr when free
+        std::uint32_t writes;
+        std::uint32_t skips;
+        std::atomic<std::uint32_t> recoveries;
+};
+
+//batch scope, everything set while it's alive goes out when it ends
+class MotorBatch{
+    public:
+        MotorBatch(MotorOutput&);
+        ~MotorBatch();
+
+    private:
+        MotorOutput &output;
+};
+
+inline MotorOutput::MotorOutput(){
+    count = 0;
+    for(int i = 0; i < maxBatches; i++){
+        batches[i].task = nullptr;
+        batches[i].opened = 0;
+    }
+    holder = nullptr;
+    writes = 0;
+    skips = 0;
+    recoveries = 0;
+}
+
+//add motors interleaved between the sides so one side never lags the other
+//by more than a single command
+inline void MotorOutput::add(pros::Motor *motor){
+    if(count < maxMotors){
+        motors[count] = motor;
+        targets[count] = 0;
+        dirty[count] = false;
+        sent[count] = 0;
+        written[count] = false;
+        count++;
+    }
+}
+
+//the calling task's open batch, nullptr outside one. a slot older than
+//staleTime was left by a deleted task that had the same handle, the kernel
+//runs every competition mode on one, and is dropped
+inline MotorOutput::Batch *MotorOutput::findBatch(){
+    pros::task_t current = pros::c::task_get_current();
+    for(int i = 0; i < maxBatches; i++){
+        if(batches[i].task == current){
+            if(pros::millis() - batches[i].opened > staleTime){
+                batches[i].task = nullptr;
+                recoveries++;
+                return nullptr;
+            }
+            return &batches[i];
+        }
+    }
+    return nullptr;
+}
+
+//only around the motor writes, which never block for long. a task deleted
+//while it holds the lock can't give it back, so a waiter that has seen the
+//same holder for staleTime takes it over
+inline void MotorOutput::lock(){
+    pros::task_t current = pros::c::task_get_current();
+    pros::task_t waitingOn = nullptr;
+    std::uint32_t since = 0;
+    while(true){
+        pros::task_t expected = nullptr;
+        if(holder.compare_exchange_strong(expected, current)){
+            return;
+        }
+        //nobody takes it twice, so it was held by a deleted task on this handle
+        bool stuck = expected == current;
+        if(expected != waitingOn){
+            waitingOn = expected;
+            since = pros::millis();
+        }else if(pros::millis() - since > staleTime){
+            stuck = true;
+        }
+        if(stuck && holder.compare_exchange_strong(expected, current)){
+            recoveries++;
+            return;
+        }
+        pros::delay(1);
+    }
+}
+
+inline void MotorOutput::unlock(){
+    holder = nullptr;
+}
+
+//voltage in mV, motors that were never added are written directly
+inline void MotorOutput::set(pros::Motor &motor, int voltage){
+    for(int i = 0; i < count; i++){
+        if(motors[i] == &motor){
+            Batch *batch = findBatch();
+            if(batch != nullptr){
+                batch->targets[i] = voltage;
+                batch->pending |= 1u << i;
+                return;
+            }
+            lock();
+            targets[i] = voltage;
+            dirty[i] = true;
+            write(i);
+            unlock();
+            return;
+        }
+    }
+    motor.move_voltage(voltage);
+}
+
+//last voltage written or about to be, 0 for one that was never added. a
+//batch's targets only show once it closes
+inline int MotorOutput::getTarget(pros::Motor &motor){
+    for(int i = 0; i < count; i++){
+        if(motors[i] == &motor){
+            return targets[i];
+        }
+    }
+    return 0;
+}
+
+//write every target that changed since it was last sent
+inline void MotorOutput::flush(){
+    lock();
+    for(int i = 0; i < count; i++){
+        write(i);
+    }
+    unlock();
+}
+
+inline void MotorOutput::write(int i){
+    if(!dirty[i].exchange(false)){
+        return;
+    }
+    int target = targets[i];
+    if(written[i] && sent[i] == target){
+        skips++;
+        return;
+    }
+    motors[i]->move_voltage(target);
+    sent[i] = target;
+    written[i] = true;
+    writes++;
+}
+
+//batches nest, only the outermost one flushes. with every slot taken the
+//batch isn't held back, its writes go straight out
+inline void MotorOutput::beginBatch(){
+    Batch *batch = findBatch();
+    if(batch != nullptr){
+        batch->depth++;
+        return;
+    }
+    //a free slot first, one left by a deleted task only when there's none
+    pros::task_t current = pros::c::task_get_current();
+    for(int pass = 0; pass < 2; pass++){
+        for(int i = 0; i < maxBatches; i++){
+            pros::task_t expected = nullptr;
+            if(pass == 1){
+                expected = batches[i].task;
+                if(pros::millis() - batches[i].opened <= staleTime){
+                    continue;
+                }
+            }
+            if(batches[i].task.compare_exchange_strong(expected, current)){
+                recoveries += pass;
+                batches[i].opened = pros::millis();
+                batches[i].depth = 1;
+                batches[i].pending = 0;
+                return;
+            }
+        }
+    }
+}
+
+inline void MotorOutput::endBatch(){
+    Batch *batch = findBatch();
+    if(batch == nullptr || --batch->depth > 0){
+        return;
+    }
+    lock();
+    for(int i = 0; i < count; i++){
+        if(batch->pending & 1u << i){
+            targets[i] = batch->targets[i];
+            dirty[i] = true;
+        }
+    }
+    for(int i = 0; i < count; i++){
+        write(i);
+    }
+    unlock();
+    batch->task = nullptr;
+}
+
+//forget what was sent so the next set() of every port is written even if
+//it's the same, for when the motors may not be doing what was last sent:
+//after the robot was disabled, or something drove them without going
+//through here. call it first thing in each competition mode, it also drops
+//a batch the last mode's task left open on the same handle
+inline void MotorOutput::invalidate(){
+    Batch *batch = findBatch();
+    if(batch != nullptr){
+        batch->task = nullptr;
+        recoveries++;
+    }
+    lock();
+    for(int i = 0; i < count; i++){
+        written[i] = false;
+    }
+    unlock();
+}
+
+inline std::uint32_t MotorOutput::getWrites(){
+    return writes;
+}
+
+inline std::uint32_t MotorOutput::getSkips(){
+    return skips;
+}
+
+//batch slots and locks taken back from deleted tasks
+inline std::uint32_t MotorOutput::getRecoveries(){
+    return recoveries;
+}
+
+inline MotorBatch::MotorBatch(MotorOutput &motorOutput) : output(motorOutput){
+    output.beginBatch();
+}
+
+inline MotorBatch::~MotorBatch(){
+    output.endBatch();
+}
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef ODOMETRY_HPP
+#define ODOMETRY_HPP
+
+#include <math.h>
+#include "snapshot.hpp"
+
+//field pose in okapi's OdomState frame: x forward from where the robot
+//started, y to its right, theta clockwise like the imu. feet and degrees
+struct Pose{
+    double x;
+    double y;
+    double theta;
+};
+
+//same helpers as okapi's OdomMath, on plain feet/degrees
+inline double constrainAngle180(double degrees){
+    degrees = fmod(degrees + 180, 360);
+    return (degrees < 0 ? degrees + 360 : degrees) - 180;
+}
+
+inline double distanceToPoint(Pose pose, double x, double y){
+    return hypot(x - pose.x, y - pose.y);
+}
+
+//how far the robot has to turn (clockwise positive) to face the point
+inline double angleToPoint(Pose pose, double x, double y){
+    double heading = atan2(y - pose.y, x - pose.x) * 180 / M_PI;
+    return constrainAngle180(heading - pose.theta);
+}
+
+//dead reckoning from the two drive sides plus the imu. heading comes from the
+//imu whenever it has a reading, the wheel speed difference is only the
+//fallback. update() must only be called from one task, getPose() is safe
+//from any task
+class Odometry{
+    public:
+        Odometry(double);
+        void update(double, double, double);
+        Pose getPose();
+        void setPose(Pose);
+
+    private:
+        Snapshot<Pose> pose;
+        Snapshot<Pose> resetRequest;
+        std::uint32_t resetsHandled;
+        double trackWidth;
+        double lastLeft;
+        double lastRight;
+        double imuOffset;
+        bool started;
+        Pose current;
+};
+
+inline Odometry::Odometry(double trackWidthFeet){
+    trackWidth = trackWidthFeet;
+    resetsHandled = 0;
+    lastLeft = 0;
+    lastRight = 0;
+    imuOffset = 0;
+    started = false;
+    current = {0, 0, 0};
+}
+
+//left and right are the total distance each side has driven in feet, imu is
+//the raw imu rotation in degrees (INFINITY when there's no reading)
+inline void Odometry::update(double left, double right, double imu){
+    bool imuValid = imu != INFINITY && !isnan(imu);
+
+    if(!started){
+        lastLeft = left;
+        lastRight = right;
+        imuOffset = imuValid ? imu - current.theta : NAN;
+        started = true;
+    }
+
+    if(resetRequest.getVersion() != resetsHandled){
+        resetsHandled = resetRequest.getVersion();
+        current = resetRequest.read();
+        imuOffset = imuValid ? imu - current.theta : NAN;
+    }
+
+    double dLeft = left - lastLeft;
+    double dRight = right - lastRight;
+    lastLeft = left;
+    lastRight = right;
+
+    double theta;
+    if(imuValid){
+        //pick the imu back up where the encoders left off after a dropout
+        if(isnan(imuOffset)){
+            imuOffset = imu - current.theta;
+        }
+        theta = imu - imuOffset;
+    }else{
+        theta = current.theta + (dLeft - dRight) / trackWidth * 180 / M_PI;
+        imuOffset = NAN;
+    }
+
+    //integrate along the average heading over the step
+    double distance = (dLeft + dRight) / 2;
+    double midHeading = (current.theta + theta) / 2 * M_PI / 180;
+    current.x += distance * cos(midHeading);
+    current.y += distance * sin(midHeading);
+    current.theta = theta;
+    pose.write(current);
+}
+
+inline Pose Odometry::getPose(){
+    return pose.read();
+}
+
+//takes effect on the next update. only call from one task at a time
+inline void Odometry::setPose(Pose newPose){
+    resetRequest.write(newPose);
+}
+
+#endif
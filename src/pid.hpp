@@ -0,0 +1,143 @@
+#ifndef PID_HPP
+#define PID_HPP
+
+#include <math.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "main.h"
+#include "okapi/api/control/util/settledUtil.hpp"
+#include "okapi/impl/util/timer.hpp"
+
+struct PIDGains{
+    double kP;
+    double kI;
+    double kD;
+};
+
+//gains for one band of error. a stage is used while |error| is at or below
+//its maxError, stages are checked in order so list the tightest band first
+struct GainStage{
+    double maxError;
+    PIDGains gains;
+    double minOutput;   //smallest output while outside the settle band, beats static friction
+};
+
+struct PIDLimits{
+    double integralZone;    //error only integrates while |error| is below this
+    double integralLimit;   //clamp on kI * integral, in output units
+    double maxOutput;
+};
+
+//settled once |error| <= error and its change per tick <= derivative for time ms
+struct SettleLimits{
+    double error;
+    double derivative;
+    std::uint32_t time;
+};
+
+//gain scheduled pid that runs once per control tick. the derivative is taken
+//on the measurement so a new target doesn't kick the output, the integral is
+//held to a zone and clamped so it can't wind up, and settling is judged by
+//okapi's SettledUtil on time spent in the settle band
+class PIDController{
+    public:
+        PIDController(std::vector<GainStage>, PIDLimits, SettleLimits);
+        void reset(double);
+        double step(double, double);
+        bool isSettled();
+        double getError();
+        void setGains(std::size_t, PIDGains);
+        PIDGains getGains(std::size_t);
+        std::size_t getStageCount();
+
+    private:
+        std::vector<GainStage> stages;
+        PIDLimits limits;
+        SettleLimits settle;
+        std::unique_ptr<okapi::SettledUtil> settledUtil;
+        double lastMeasurement;
+        double integral;
+        double error;
+        bool settled;
+};
+
+inline PIDController::PIDController(std::vector<GainStage> gainStages, PIDLimits pidLimits, SettleLimits settleLimits)
+    : stages(gainStages), limits(pidLimits), settle(settleLimits),
+      settledUtil(std::make_unique<okapi::SettledUtil>(std::make_unique<okapi::Timer>(), settleLimits.error,
+                                                       settleLimits.derivative, settleLimits.time * okapi::millisecond)){
+    lastMeasurement = 0;
+    integral = 0;
+    error = 0;
+    settled = false;
+}
+
+//call right before the first step of a move with the current measurement
+inline void PIDController::reset(double measurement){
+    lastMeasurement = measurement;
+    integral = 0;
+    error = 0;
+    settled = false;
+    settledUtil->reset();
+}
+
+//one tick, returns the output
+inline double PIDController::step(double target, double measurement){
+    double lastError = error;
+    error = target - measurement;
+    double derivative = -(measurement - lastMeasurement);
+    lastMeasurement = measurement;
+    settled = settledUtil->isSettled(error);
+
+    const GainStage *stage = &stages.back();
+    for(const GainStage &s : stages){
+        if(fabs(error) <= s.maxError){
+            stage = &s;
+            break;
+        }
+    }
+    PIDGains gains = stage->gains;
+
+    //only integrate close in, and start over when the error crosses zero so
+    //the overshoot doesn't have to unwind it first
+    if(fabs(error) < limits.integralZone && gains.kI != 0){
+        if((error > 0) != (lastError > 0)){
+            integral = 0;
+        }
+        integral += error;
+        double integralLimit = limits.integralLimit / fabs(gains.kI);
+        integral = fmin(fmax(integral, -integralLimit), integralLimit);
+    }else{
+        integral = 0;
+    }
+
+    double output = gains.kP * error + gains.kI * integral + gains.kD * derivative;
+    if(fabs(error) > settle.error && fabs(output) < stage->minOutput){
+        output = error > 0 ? stage->minOutput : -stage->minOutput;
+    }
+    return fmin(fmax(output, -limits.maxOutput), limits.maxOutput);
+}
+
+inline bool PIDController::isSettled(){
+    return settled;
+}
+
+inline double PIDController::getError(){
+    return error;
+}
+
+inline void PIDController::setGains(std::size_t stage, PIDGains gains){
+    if(stage < stages.size()){
+        stages[stage].gains = gains;
+    }
+}
+
+inline PIDGains PIDController::getGains(std::size_t stage){
+    return stage < stages.size() ? stages[stage].gains : PIDGains{0, 0, 0};
+}
+
+inline std::size_t PIDController::getStageCount(){
+    return stages.size();
+}
+
+#endif
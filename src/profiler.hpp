@@ -0,0 +1,133 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include "main.h"
+
+//run time histogram for one named section of code. sections are static
+//objects that link themselves into a list as they're constructed, so nothing
+//is allocated and dumpAll() finds every one. the counts are atomic, so a
+//section can be timed from several tasks at once, e.g. the drive loop from
+//the motion and autonomous tasks.
+//pros 3.2 only has a millisecond clock and the loops wake right on a tick,
+//so anything shorter than a ms reads 0 nearly every time, its mean too. the
+//sections are therefore whole ticks, a LoopTimer given a section records
+//the time from each scheduled wake to the next wait(), and the histogram
+//says how much of the loop's budget the tick used and how often it came
+//close. what a tick spends inside itself can't be split up this way, for
+//that time many back to back runs of the code on the bench, like
+//sim/curvebench does
+class ProfileSection{
+    public:
+        ProfileSection(const char*);
+        void add(std::uint32_t);
+        void clear();
+        const char *getName();
+        std::uint32_t getCount();
+        double getMean();
+        std::uint32_t getPercentile(double);
+        std::uint32_t getMax();
+        static void dumpAll(FILE*);
+
+    private:
+        static const int bucketCount = 32;  //1ms each, the last one holds everything longer
+        inline static ProfileSection *head = nullptr;
+
+        const char *name;
+        std::atomic<std::uint32_t> buckets[bucketCount];
+        std::atomic<std::uint32_t> count;
+        std::atomic<std::uint32_t> total;
+        std::atomic<std::uint32_t> max;
+        ProfileSection *next;
+};
+
+//times its own scope into a section
+class ScopedTimer{
+    public:
+        ScopedTimer(ProfileSection&);
+        ~ScopedTimer();
+
+    private:
+        ProfileSection &section;
+        std::uint32_t start;
+};
+
+inline ProfileSection::ProfileSection(const char *sectionName){
+    name = sectionName;
+    clear();
+    next = head;
+    head = this;
+}
+
+//ms
+inline void ProfileSection::add(std::uint32_t time){
+    buckets[time < bucketCount ? time : bucketCount - 1]++;
+    count++;
+    total += time;
+    std::uint32_t longest = max;
+    while(time > longest && !max.compare_exchange_weak(longest, time)){}
+}
+
+inline void ProfileSection::clear(){
+    for(int i = 0; i < bucketCount; i++){
+        buckets[i] = 0;
+    }
+    count = 0;
+    total = 0;
+    max = 0;
+}
+
+inline const char *ProfileSection::getName(){
+    return name;
+}
+
+inline std::uint32_t ProfileSection::getCount(){
+    return count;
+}
+
+//ms
+inline double ProfileSection::getMean(){
+    std::uint32_t runs = count;
+    return runs == 0 ? 0 : (double)total / runs;
+}
+
+//ms, fraction from 0 to 1
+inline std::uint32_t ProfileSection::getPercentile(double fraction){
+    std::uint32_t rank = fraction * count.load();
+    std::uint32_t seen = 0;
+    for(int i = 0; i < bucketCount; i++){
+        seen += buckets[i];
+        if(seen > rank){
+            return i;
+        }
+    }
+    return max;
+}
+
+inline std::uint32_t ProfileSection::getMax(){
+    return max;
+}
+
+//one line per section that has run, e.g. to stdout or a file on the sd card
+inline void ProfileSection::dumpAll(FILE *out){
+    std::fprintf(out, "%-16s %8s %8s %5s %5s %5s  (ms)\n", "section", "count", "mean", "p50", "p99", "max");
+    for(ProfileSection *s = head; s != nullptr; s = s->next){
+        if(s->count > 0){
+            std::fprintf(out, "%-16s %8u %8.3f %5u %5u %5u\n", s->name, (unsigned)s->count, s->getMean(),
+                         (unsigned)s->getPercentile(.5), (unsigned)s->getPercentile(.99), (unsigned)s->getMax());
+        }
+    }
+    std::fflush(out);
+}
+
+inline ScopedTimer::ScopedTimer(ProfileSection &timedSection) : section(timedSection){
+    start = pros::millis();
+}
+
+inline ScopedTimer::~ScopedTimer(){
+    section.add(pros::millis() - start);
+}
+
+#endif
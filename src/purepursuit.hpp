@@ -0,0 +1,220 @@
+#ifndef PUREPURSUIT_HPP
+#define PUREPURSUIT_HPP
+
+#include <math.h>
+#include <vector>
+#include "arena.hpp"
+#include "odometry.hpp"
+#include "utility.hpp"
+
+struct Waypoint{
+    double x;   //ft, same frame as Pose
+    double y;
+};
+
+struct PursuitLimits{
+    double velocity;        //ft/s
+    double acceleration;    //ft/s^2, used to slow down for the end of the path
+    double turnSpeed;       //ft/s the robot can hold on a 1 ft radius, slows it on curves
+    double minLookahead;    //ft
+    double maxLookahead;    //ft
+    double lookaheadGain;   //s, lookahead grows by this many seconds of travel
+};
+
+//output of one pure pursuit step, side velocities in ft/s
+struct PursuitCommand{
+    double left;
+    double right;
+    bool finished;
+};
+
+//pure pursuit over a list of field waypoints. the path is resampled into
+//short segments and each point gets a target speed from its curvature and
+//the distance left, so the robot slows into corners and the end. the
+//lookahead grows with speed so straights stay smooth and tight curves are
+//still followed at low speed. the resampled path lives in the arena, which
+//has to outlive the follower. a path needs at least two waypoints, with fewer
+//step() reports it finished straight away
+class PurePursuit{
+    public:
+        PurePursuit(const std::vector<Waypoint>&, PursuitLimits, double, Arena&);
+        PursuitCommand step(Pose, double);
+        double getLength();
+        double getProgress();
+
+    private:
+        bool findLookahead(Pose, double, Waypoint&);
+
+        std::vector<Waypoint, ArenaAllocator<Waypoint>> points;
+        std::vector<double, ArenaAllocator<double>> distances;  //path length up to each point
+        std::vector<double, ArenaAllocator<double>> speeds;     //target speed at each point
+        PursuitLimits limits;
+        double trackWidth;
+        std::size_t closest;
+        double lookaheadIndex;          //fractional segment index, never goes backwards
+        Waypoint lookaheadPoint;
+};
+
+inline PurePursuit::PurePursuit(const std::vector<Waypoint> &waypoints, PursuitLimits pursuitLimits,
+                                double trackWidthFeet, Arena &arena)
+    : points(ArenaAllocator<Waypoint>(arena)), distances(ArenaAllocator<double>(arena)),
+      speeds(ArenaAllocator<double>(arena)){
+    limits = pursuitLimits;
+    trackWidth = trackWidthFeet;
+    closest = 0;
+    lookaheadIndex = 0;
+    lookaheadPoint = waypoints.empty() ? Waypoint{0, 0} : waypoints.front();
+    if(waypoints.size() < 2){
+        return;
+    }
+
+    //resample every few inches so curvature and closest point are smooth.
+    //counted first so each array is taken from the arena exactly once
+    double spacing = 0.25;
+    std::size_t total = 1;
+    for(std::size_t i = 0; i + 1 < waypoints.size(); i++){
+        double length = hypot(waypoints[i + 1].x - waypoints[i].x, waypoints[i + 1].y - waypoints[i].y);
+        total += max((int)(length / spacing), 1);
+    }
+    points.reserve(total);
+    distances.reserve(total);
+    speeds.reserve(total);
+    for(std::size_t i = 0; i + 1 < waypoints.size(); i++){
+        Waypoint a = waypoints[i];
+        Waypoint b = waypoints[i + 1];
+        double length = hypot(b.x - a.x, b.y - a.y);
+        int count = length / spacing;
+        for(int j = 0; j < max(count, 1); j++){
+            double f = (double)j / max(count, 1);
+            points.push_back({a.x + (b.x - a.x) * f, a.y + (b.y - a.y) * f});
+        }
+    }
+    points.push_back(waypoints.back());
+
+    distances.assign(points.size(), 0);
+    for(std::size_t i = 1; i < points.size(); i++){
+        distances[i] = distances[i - 1] + hypot(points[i].x - points[i - 1].x, points[i].y - points[i - 1].y);
+    }
+
+    //curvature from the circle through each point and its neighbours
+    speeds.assign(points.size(), limits.velocity);
+    for(std::size_t i = 1; i + 1 < points.size(); i++){
+        Waypoint p = points[i - 1];
+        Waypoint q = points[i];
+        Waypoint r = points[i + 1];
+        double a = hypot(q.x - p.x, q.y - p.y);
+        double b = hypot(r.x - q.x, r.y - q.y);
+        double c = hypot(r.x - p.x, r.y - p.y);
+        double cross = fabs((q.x - p.x) * (r.y - p.y) - (q.y - p.y) * (r.x - p.x));
+        double curvature = a * b * c == 0 ? 0 : 2 * cross / (a * b * c);
+        if(curvature > 0){
+            speeds[i] = fmin(limits.velocity, limits.turnSpeed / curvature);
+        }
+    }
+
+    //can't be going faster than it can stop from by the next slow point
+    speeds.back() = 0;
+    for(std::size_t i = speeds.size() - 1; i-- > 0;){
+        double gap = distances[i + 1] - distances[i];
+        speeds[i] = fmin(speeds[i], sqrt(speeds[i + 1] * speeds[i + 1] + 2 * limits.acceleration * gap));
+    }
+}
+
+//first intersection of the lookahead circle with the path past the last one
+inline bool PurePursuit::findLookahead(Pose pose, double radius, Waypoint &result){
+    for(std::size_t i = (std::size_t)lookaheadIndex; i + 1 < points.size(); i++){
+        Waypoint a = points[i];
+        Waypoint b = points[i + 1];
+        double dx = b.x - a.x;
+        double dy = b.y - a.y;
+        double fx = a.x - pose.x;
+        double fy = a.y - pose.y;
+        double qa = dx * dx + dy * dy;
+        double qb = 2 * (fx * dx + fy * dy);
+        double qc = fx * fx + fy * fy - radius * radius;
+        double disc = qb * qb - 4 * qa * qc;
+        if(qa == 0 || disc < 0){
+            continue;
+        }
+        disc = sqrt(disc);
+        double t2 = (-qb + disc) / (2 * qa);
+        double t1 = (-qb - disc) / (2 * qa);
+        for(double t : {t2, t1}){
+            if(t >= 0 && t <= 1 && i + t >= lookaheadIndex){
+                lookaheadIndex = i + t;
+                lookaheadPoint = {a.x + t * dx, a.y + t * dy};
+                result = lookaheadPoint;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+//velocity is the robot's current forward speed in ft/s
+inline PursuitCommand PurePursuit::step(Pose pose, double velocity){
+    if(points.size() < 2){
+        return {0, 0, true};
+    }
+
+    //closest point only searched forward so the robot can't skip back
+    double best = hypot(points[closest].x - pose.x, points[closest].y - pose.y);
+    for(std::size_t i = closest + 1; i < points.size(); i++){
+        double d = hypot(points[i].x - pose.x, points[i].y - pose.y);
+        if(d < best){
+            best = d;
+            closest = i;
+        }
+    }
+
+    //done once past the end of the path
+    Waypoint end = points.back();
+    Waypoint beforeEnd = points[points.size() - 2];
+    double endX = end.x - beforeEnd.x;
+    double endY = end.y - beforeEnd.y;
+    double past = ((pose.x - end.x) * endX + (pose.y - end.y) * endY) / hypot(endX, endY);
+    if(closest == points.size() - 1 && (past >= 0 || best < 1.0 / 12)){
+        return {0, 0, true};
+    }
+
+    double lookahead = limits.minLookahead + limits.lookaheadGain * fabs(velocity);
+    lookahead = fmin(fmax(lookahead, limits.minLookahead), limits.maxLookahead);
+    //no intersection means either the end is inside the circle or the
+    //lookahead shrank as the robot slowed, then keep chasing the last point
+    Waypoint target;
+    if(!findLookahead(pose, lookahead, target)){
+        target = hypot(end.x - pose.x, end.y - pose.y) < lookahead ? end : lookaheadPoint;
+    }
+
+    //lookahead point in the robot's frame, x forward and y to the right
+    double theta = pose.theta * M_PI / 180;
+    double dx = target.x - pose.x;
+    double dy = target.y - pose.y;
+    double forward = dx * cos(theta) + dy * sin(theta);
+    double right = -dx * sin(theta) + dy * cos(theta);
+    double distance = hypot(forward, right);
+    double curvature = distance == 0 ? 0 : 2 * right / (distance * distance);
+
+    //the closest resampled point can be a few inches stale, so the slowdown
+    //for the end is recomputed from the live distance. the floor keeps the
+    //robot from stalling on static friction right before the end
+    double speed = speeds[closest];
+    double stopping = sqrt(2 * limits.acceleration * hypot(end.x - pose.x, end.y - pose.y));
+    speed = fmax(fmin(speed, stopping), fmin(limits.velocity, 0.5));
+    if(forward < 0 && closest == points.size() - 1){
+        speed = 0;
+    }
+
+    //a clockwise curve (positive curvature) needs the left side faster
+    return {speed * (1 + curvature * trackWidth / 2), speed * (1 - curvature * trackWidth / 2), false};
+}
+
+inline double PurePursuit::getLength(){
+    return distances.empty() ? 0 : distances.back();
+}
+
+inline double PurePursuit::getProgress(){
+    return distances.empty() ? 0 : distances[closest];
+}
+
+#endif
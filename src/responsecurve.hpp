@@ -0,0 +1,114 @@
+#ifndef RESPONSECURVE_HPP
+#define RESPONSECURVE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "utility.hpp"
+
+//joystick response curve as a 256 entry table built at compile time, so
+//shaping a stick value is a single indexed load. the index is the stick
+//value + 128, anything outside -128 to 127 is clamped first. entries are
+//motor millivolts, -12000 to 12000, so the curve keeps its shape at low stick
+//instead of rounding to 127 steps. full stick is full voltage, -128 reads as -127
+struct ResponseCurve{
+    std::int16_t table[256];
+
+    constexpr int operator()(int value) const{
+        return table[saturate<std::int8_t>(value) + 128];
+    }
+};
+
+//one point of a custom curve, both on the 0 to 127 stick scale
+struct CurvePoint{
+    int input;
+    int output;
+};
+
+//std::exp isn't constexpr. halve x until the series converges fast, then
+//square back up
+constexpr double curveExp(double x){
+    int halvings = 0;
+    while(x > 0.5 || x < -0.5){
+        x /= 2;
+        halvings++;
+    }
+    double sum = 1;
+    double term = 1;
+    for(int i = 1; i < 12; i++){
+        term *= x / i;
+        sum += term;
+    }
+    for(int i = 0; i < halvings; i++){
+        sum *= sum;
+    }
+    return sum;
+}
+
+//stick value for a table index
+constexpr int curveInput(int index){
+    return index < 1 ? -127 : index - 128;
+}
+
+//float to int truncates toward zero, same as the old cubifySpeed
+constexpr ResponseCurve makeLinearCurve(){
+    ResponseCurve curve{};
+    for(int i = 0; i < 256; i++){
+        curve.table[i] = curveInput(i) * MAX_VOLTAGE / 127;
+    }
+    return curve;
+}
+
+//(x / 127)^3 at full voltage, what cubifySpeed did with pow()
+constexpr ResponseCurve makeCubicCurve(){
+    ResponseCurve curve{};
+    for(int i = 0; i < 256; i++){
+        double x = curveInput(i) / 127.0;
+        curve.table[i] = (int)(x * x * x * MAX_VOLTAGE);
+    }
+    return curve;
+}
+
+//the usual vex exponential drive curve, fine control near the middle and a
+//quicker ramp to full speed at the end. bigger strength is flatter near 0
+constexpr ResponseCurve makeExponentialCurve(double strength){
+    ResponseCurve curve{};
+    double low = curveExp(-strength / 10);
+    for(int i = 0; i < 256; i++){
+        int x = curveInput(i);
+        int magnitude = x < 0 ? -x : x;
+        curve.table[i] = (int)((low + curveExp((magnitude - 127) / 10.0) * (1 - low)) * x * MAX_VOLTAGE / 127);
+    }
+    return curve;
+}
+
+//straight lines between the points for the positive side, mirrored for the
+//negative side. points go in order of input and should start at {0, 0}
+template <std::size_t N>
+constexpr ResponseCurve makePiecewiseCurve(const CurvePoint (&points)[N]){
+    ResponseCurve curve{};
+    for(int i = 0; i < 256; i++){
+        int x = curveInput(i);
+        int magnitude = x < 0 ? -x : x;
+        double output = points[N - 1].output;
+        for(std::size_t j = 0; j + 1 < N; j++){
+            if(magnitude <= points[j + 1].input){
+                double f = (double)(magnitude - points[j].input) / (points[j + 1].input - points[j].input);
+                output = points[j].output + (points[j + 1].output - points[j].output) * f;
+                break;
+            }
+        }
+        output = output * MAX_VOLTAGE / 127;
+        curve.table[i] = (int)(x < 0 ? -output : output);
+    }
+    return curve;
+}
+
+inline constexpr ResponseCurve linearCurve = makeLinearCurve();
+inline constexpr ResponseCurve cubicCurve = makeCubicCurve();
+inline constexpr ResponseCurve exponentialCurve = makeExponentialCurve(12);
+
+//slow and precise up to half stick, then full speed comes in quickly
+inline constexpr CurvePoint precisePoints[] = {{0, 0}, {64, 24}, {100, 60}, {127, 127}};
+inline constexpr ResponseCurve preciseCurve = makePiecewiseCurve(precisePoints);
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef RINGBUFFER_HPP
+#define RINGBUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+//fixed size queue for one producer task and one consumer task with no locks.
+//each side only writes its own index, and the acquire/release pairs make the
+//slot contents visible before the index that publishes them. push() never
+//waits, when the consumer falls behind new items are dropped and counted
+template <typename T, std::size_t N>
+class RingBuffer{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "RingBuffer size must be a power of two");
+
+    public:
+        RingBuffer();
+        bool push(const T&);
+        bool pop(T&);
+        std::size_t size();
+        std::uint32_t getDropped();
+
+    private:
+        T items[N];
+        std::atomic<std::size_t> head;  //next slot to write, only the producer moves it
+        std::atomic<std::size_t> tail;  //next slot to read, only the consumer moves it
+        std::atomic<std::uint32_t> dropped;
+};
+
+template <typename T, std::size_t N>
+RingBuffer<T, N>::RingBuffer() : head(0), tail(0), dropped(0){}
+
+//producer side, false if it was full and the item was dropped
+template <typename T, std::size_t N>
+bool RingBuffer<T, N>::push(const T &item){
+    std::size_t h = head.load(std::memory_order_relaxed);
+    if(h - tail.load(std::memory_order_acquire) == N){
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    items[h & (N - 1)] = item;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+}
+
+//consumer side, false if there was nothing waiting
+template <typename T, std::size_t N>
+bool RingBuffer<T, N>::pop(T &item){
+    std::size_t t = tail.load(std::memory_order_relaxed);
+    if(head.load(std::memory_order_acquire) == t){
+        return false;
+    }
+    item = items[t & (N - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, std::size_t N>
+std::size_t RingBuffer<T, N>::size(){
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+}
+
+template <typename T, std::size_t N>
+std::uint32_t RingBuffer<T, N>::getDropped(){
+    return dropped.load(std::memory_order_relaxed);
+}
+
+#endif
@@ -1,5 +1,41 @@
 #include "main.h"
 #include "utility.hpp"
+#include "looptimer.hpp"
+#include "motoroutput.hpp"
+#include "slewlimiter.hpp"
+#include "responsecurve.hpp"
+#include "motionprofile.hpp"
+#include "pid.hpp"
+#include "gaintuner.hpp"
+#include "feedforward.hpp"
+#include "asyncmotion.hpp"
+#include "odometry.hpp"
+#include "sensorstate.hpp"
+#include "snapshot.hpp"
+#include "telemetry.hpp"
+#include "blackbox.hpp"
+#include "inputlog.hpp"
+#include "purepursuit.hpp"
+#include "trajectory.hpp"
+#include "profiler.hpp"
+#include "arena.hpp"
+#include "heapguard.hpp"
+
+//one sample per tick of each loop, see LoopTimer
+inline ProfileSection sensorTickProfile("sensor tick");
+inline ProfileSection driveTickProfile("drive tick");
+inline ProfileSection turnTickProfile("turn tick");
+
+enum class MotionType{
+    drive,
+    sProfile,
+    sineProfile,
+    turn,
+    driveToPoint,
+    driveToPose,
+    followPath,
+    followTrajectory
+};
 
 class Robot{
     public:
@@ -18,34 +54,117 @@ class Robot{
     	pros::ADIDigitalIn front_limitswitch;
     	pros::Imu imu;
 
-        Robot(int, int, int);
+        //every motor write goes through here, see setDriveVoltage
+        MotorOutput output;
+
+        //fed by the sensor task once started, see Telemetry::start and BlackBox::start
+        Telemetry telemetry;
+        BlackBox blackbox;
+        void setInput(ControllerInput*);
+
+        //driver control ramps, mV per second
+        SlewLimiter leftSlew;
+        SlewLimiter rightSlew;
+        SlewLimiter intakeSlew;
+        SlewLimiter rollerSlew;
+
+        Robot(double, double, int);
         void initialize();
         void arcadeDrive(int, int, bool);
         void tankDrive(int, int, bool);
-        void setDriveSpeed(int);
-        void setDriveSpeed(int, int);
-        void setIntakeSpeed(int);
-        void setRollerSpeed(int, int);
+        void setDriveVoltage(int);
+        void setDriveVoltage(int, int);
+        void setIntakeVoltage(int);
+        void setRollerVoltage(int, int);
         int deadband(int, int);
-        int cubifySpeed(int);
-        int limitAcceleration(int, int, int, int);
+        int shapeVoltage(int);
+        void setDriveCurve(const ResponseCurve&);
         void limitMotor(pros::Motor, int, int, int);
         void forceLimitMotor(pros::Motor, int, int, int, int);
         void drive(double, int);
         void driveSProfile(double);
         void driveSineProfile(double);
+        void driveProfile(MotionProfile);
+        bool characterize();
+        double getDriveDistance();
+        double getLeftDistance();
+        double getRightDistance();
+        SensorState getSensors();
+        double getRotation();
+        Pose getPose();
+        void setPose(Pose);
         void turn(double);
+        void turnToPoint(double, double);
+        void driveToPoint(double, double, int);
+        void driveToPose(double, double, double, int);
+        void followPath(const std::vector<Waypoint>&, int);
+        void followTrajectory(Trajectory);
+
+        //the same moves run on the motion task so mechanisms can be driven
+        //while the robot moves. starting a move waits for the previous one
+        AsyncMotion driveAsync(double, int);
+        AsyncMotion driveSProfileAsync(double);
+        AsyncMotion driveSineProfileAsync(double);
+        AsyncMotion turnAsync(double);
+        AsyncMotion driveToPointAsync(double, double, int);
+        AsyncMotion driveToPoseAsync(double, double, double, int);
+        AsyncMotion followPathAsync(const std::vector<Waypoint>&, int);
+        AsyncMotion followTrajectoryAsync(Trajectory);
+        void waitUntilSettled();
+        void stop();
+
+        LoopTimer driveLoop;
+        LoopTimer turnLoop;
+        LoopTimer sensorLoop;
+
+        //public so the gains can be tuned live
+        PIDController turnPID;
+        PIDGains driveGains;    //position feedback of the profiled drives, mV per ft
+        Feedforward leftFeedforward;    //drive model of each side, found by characterize()
+        Feedforward rightFeedforward;
+
+        MoveScore getLastScore();
+        bool saveGains(std::string);
+        bool loadGains(std::string);
 
     private:
-        int leftSpeed;
-        int rightSpeed;
-        int maxAccel;
-        int maxDecel;
+        MoveScore lastScore;
         int joyDeadband;
+        const ResponseCurve *driveCurve;
         int ticksPerFoot;
+        double freeSpeed;
+        ProfileLimits driveLimits;
+        double trackWidth;
+
+        Odometry odom;                  //ahead of the sensor task that updates it
+        Snapshot<SensorState> sensors;
+        pros::Task *sensorTask;
+        std::atomic<ControllerInput*> input{nullptr};  //what opcontrol drives from, see setInput
+        void sampleSensors();
+
+        void moveToPoint(double, double, double, int);
+        std::uint32_t beginMove();
+        void releasePaths();
+        bool stopRequested(std::uint32_t);
+        std::atomic<std::uint32_t> stops{0};   //bumped by stop(), a move ends when it changes
+        AsyncMotion startMotion(MotionType, double, double, double, int);
+        void motionLoop();
+        MotionStatus motion;
+        pros::Task *motionTask;
+        MotionType pendingType;
+        double pendingTarget;
+        double pendingY;
+        double pendingHeading;
+        std::vector<Waypoint> pendingPath;     //reserved up front, copying a path in doesn't allocate
+        Trajectory pendingTrajectory;
+        int pendingVoltage;
+        std::uint32_t pendingStops;     //stops when the move was issued
+
+        StaticArena<16384> pathArena;   //followPath's resampled path, about 500 points
 };
 
-Robot::Robot(int maxAcceleration, int maxDeceleration, int joystickDeadband)
+//drive acceleration and deceleration in mV per second, stick deadband
+Robot::Robot(double maxAcceleration, double maxDeceleration, int joystickDeadband)
     :controller(pros::E_CONTROLLER_MASTER),
     left_drive1(19, MOTOR_GEARSET_18, false, MOTOR_ENCODER_COUNTS),
     left_drive2(12, MOTOR_GEARSET_18, true, MOTOR_ENCODER_COUNTS),
@@ -57,10 +176,36 @@ Robot::Robot(int maxAcceleration, int maxDeceleration, int joystickDeadband)
     roller2(5, MOTOR_GEARSET_18, false),
     //rear_ultrasonic(1, 2),
     front_limitswitch('A'),
-    imu(7)
+    imu(7),
+    leftSlew(maxAcceleration, maxDeceleration),
+    rightSlew(maxAcceleration, maxDeceleration),
+    intakeSlew(60000, 120000),  //full in 0.2s, stopped in 0.1s
+    rollerSlew(60000, 120000),
+    driveLoop(10, &driveTickProfile),
+    turnLoop(10, &turnTickProfile),
+    sensorLoop(5, &sensorTickProfile),
+    turnPID({{10, {470, 7.5, 750}, 1300},          //close in, stiff with integral, just beats static friction
+             {INFINITY, {280, 0, 1130}, 2800}},    //far out, heavily damped with a minimum output
+            {10, 2800, 10400},                      //integral zone deg, integral limit mV, max output mV
+            {1, .2, 100}),                          //settled within 1 deg, .2 deg/tick for 100ms
+    driveGains({8500, 0, 0}),
+    trackWidth(12.5 / 12), //ft between the left and right wheels
+    odom(trackWidth),
+    sensorTask(nullptr),
+    motionTask(nullptr)
 {
     left_intake.set_brake_mode(MOTOR_BRAKE_BRAKE);
     right_intake.set_brake_mode(MOTOR_BRAKE_BRAKE);
+
+    //sides interleaved so a burst never leaves one side a few commands behind
+    output.add(&left_drive1);
+    output.add(&right_drive1);
+    output.add(&left_drive2);
+    output.add(&right_drive2);
+    output.add(&left_intake);
+    output.add(&right_intake);
+    output.add(&roller1);
+    output.add(&roller2);
     //tray.set_brake_mode(MOTOR_BRAKE_BRAKE);
     //lift.set_brake_mode(MOTOR_BRAKE_BRAKE);
 
@@ -73,12 +218,20 @@ Robot::Robot(int maxAcceleration, int maxDeceleration, int joystickDeadband)
     //roller1.tare_position();
     //roller2.tare_position();
 
-    leftSpeed = 0;
-    leftSpeed = 0;
-    maxAccel = maxAcceleration;
-    maxDecel = maxDeceleration;
     joyDeadband = joystickDeadband;
+    driveCurve = &cubicCurve;
     ticksPerFoot = (900 * 3/5) / ((M_PI * 3.25)/12);
+    freeSpeed = 200.0 * 900 / 60 / ticksPerFoot; //ft/s at full power
+    driveLimits = {freeSpeed * 0.8, 6, 30};
+    //until characterize() has run: 8% to break friction, full voltage at free speed
+    leftFeedforward = {960, MAX_VOLTAGE / freeSpeed, 380};
+    rightFeedforward = leftFeedforward;
+
+    //no reading until the sensor task starts in initialize()
+    sensors.write(SensorState());
+
+    pendingPath.reserve(64);
+    pendingStops = 0;
 }
 
 void Robot::initialize(){
@@ -86,208 +239,477 @@ void Robot::initialize(){
 	while(imu.is_calibrating() || imu.get_rotation() == INFINITY){
 		pros::delay(10);
 	}
+
+    //sampling runs above everything else so the sensors and pose are never
+    //stale, and twice as often as the control loops so they're at most 5ms old
+    if(sensorTask == nullptr){
+        sensorTask = new pros::Task([this]{ sampleSensors(); }, TASK_PRIORITY_DEFAULT + 3,
+                                    TASK_STACK_DEPTH_DEFAULT, "sensors");
+    }
+
+    //above autonomous/opcontrol so their work can't stretch the move loops
+    if(motionTask == nullptr){
+        motionTask = new pros::Task([this]{ motionLoop(); }, TASK_PRIORITY_DEFAULT + 2,
+                                    TASK_STACK_DEPTH_DEFAULT, "motion");
+    }
 }
 
+//stick values in, the response curve turns them into millivolts
 void Robot::arcadeDrive(int speed, int direction, bool noLimit){
     direction = deadband(direction, joyDeadband);
     speed = deadband(speed, joyDeadband);
-    int left = cubifySpeed(speed + direction * 0.85);
-    int right = cubifySpeed(speed - direction * 0.85);
+    int left = shapeVoltage(speed + direction * 0.85);
+    int right = shapeVoltage(speed - direction * 0.85);
     if(noLimit){
-        leftSpeed = left;
-        rightSpeed = right;
+        leftSlew.reset(left);
+        rightSlew.reset(right);
     }else{
-        leftSpeed = limitAcceleration(leftSpeed, left, maxAccel, maxDecel);
-        rightSpeed = limitAcceleration(rightSpeed, right, maxAccel, maxDecel);
+        left = leftSlew.step(left);
+        right = rightSlew.step(right);
     }
-    setDriveSpeed(leftSpeed, rightSpeed);
+    setDriveVoltage(left, right);
 }
 
+//stick values in, straight through to millivolts without a curve
 void Robot::tankDrive(int left, int right, bool noLimit){
-    int leftTarget = deadband(left, joyDeadband);
-    int rightTarget = deadband(right, joyDeadband);
+    left = linearCurve(deadband(left, joyDeadband));
+    right = linearCurve(deadband(right, joyDeadband));
     if(noLimit){
-        leftSpeed = leftTarget;
-        rightSpeed = rightTarget;
+        leftSlew.reset(left);
+        rightSlew.reset(right);
     }else{
-        leftSpeed = limitAcceleration(leftSpeed, leftTarget, maxAccel, maxDecel);
-        rightSpeed = limitAcceleration(rightSpeed, rightTarget, maxAccel, maxDecel);
+        left = leftSlew.step(left);
+        right = rightSlew.step(right);
     }
-    setDriveSpeed(leftSpeed, rightSpeed);
+    setDriveVoltage(left, right);
 }
 
-int Robot::cubifySpeed(int val){
-    return scale(pow(scale(trim(val, -128, 128), -128, 128, -1, 1), 3), -1, 1, -128, 128);
+//applies the driver's response curve, a table lookup from a stick value to mV
+int Robot::shapeVoltage(int val){
+    return (*driveCurve)(val);
 }
 
-void Robot::setDriveSpeed(int speed){
-    left_drive1 = speed;
-    left_drive2 = speed;
-    right_drive1 = speed;
-    right_drive2 = speed;
+//swap the arcade response curve, e.g. cubicCurve or exponentialCurve from
+//responsecurve.hpp. the curve has to outlive the robot
+void Robot::setDriveCurve(const ResponseCurve &curve){
+    driveCurve = &curve;
 }
 
-void Robot::setDriveSpeed(int left, int right){
-    left_drive1 = left;
-    left_drive2 = left;
-    right_drive1 = right;
-    right_drive2 = right;
+void Robot::setDriveVoltage(int voltage){
+    setDriveVoltage(voltage, voltage);
 }
 
-void Robot::setIntakeSpeed(int speed){
-    left_intake = speed;
-    right_intake = speed;
+//all four drive motors go out in one burst, unchanged ones are skipped.
+//voltages are in mV, -12000 to 12000
+void Robot::setDriveVoltage(int left, int right){
+    MotorBatch batch(output);
+    output.set(left_drive1, left);
+    output.set(left_drive2, left);
+    output.set(right_drive1, right);
+    output.set(right_drive2, right);
 }
 
-void Robot::setRollerSpeed(int top, int bottom){
-    roller1 = top;
-    roller2 = bottom;
+void Robot::setIntakeVoltage(int voltage){
+    MotorBatch batch(output);
+    output.set(left_intake, voltage);
+    output.set(right_intake, voltage);
 }
 
+void Robot::setRollerVoltage(int top, int bottom){
+    MotorBatch batch(output);
+    output.set(roller1, top);
+    output.set(roller2, bottom);
+}
+
+//zeroes stick values inside the band and stretches the rest so full stick is
+//still 127
 int Robot::deadband(int val, int limit){
-    int upper = limit;
-    int lower = -limit;
     if(val >= limit || val <= -limit){
-        return val + (val >= limit ? -limit : limit) * (128/(128-limit));
+        return (val + (val >= limit ? -limit : limit)) * 127.0 / (127 - limit);
     }else{
         return 0;
     }
 }
 
-int Robot::limitAcceleration(int speed, int target, int accelLimit, int deccelLimit){
-    if(abs(target - speed) < accelLimit){
-        return target;
-    }
-
-    if(target < speed && speed > 0){
-        if(abs(target - speed) > deccelLimit){
-            return speed - deccelLimit;
-        }else{
-            return target;
-        }
-    }else if(target < speed){
-        return speed - accelLimit;
-    }else if(target > speed && speed < 0){
-        if(abs(target - speed) > deccelLimit){
-            return speed + deccelLimit;
-        }else{
-            return target;
-        }
-    }else if(target > speed){
-        return speed + accelLimit;
-    }
-
-    return 0;
-}
-
-void Robot::limitMotor(pros::Motor mtr, int speed, int lower, int upper){
-    if((mtr.get_raw_position(NULL) <= lower && speed < 0) || (mtr.get_raw_position(NULL) >= upper && speed > 0)){
-        mtr = 0;
+void Robot::limitMotor(pros::Motor mtr, int voltage, int lower, int upper){
+    if((mtr.get_raw_position(NULL) <= lower && voltage < 0) || (mtr.get_raw_position(NULL) >= upper && voltage > 0)){
+        mtr.move_voltage(0);
     }else{
-        mtr = speed;
+        mtr.move_voltage(voltage);
     }
 }
 
-void Robot::forceLimitMotor(pros::Motor mtr, int speed, int correctionSpeed, int lower, int upper){
-    if(mtr.get_raw_position(NULL) <= lower && speed <= 0){
-        mtr = correctionSpeed;
-    }else if(mtr.get_raw_position(NULL) >= upper && speed >= 0){
-        mtr = -correctionSpeed;
+void Robot::forceLimitMotor(pros::Motor mtr, int voltage, int correctionVoltage, int lower, int upper){
+    if(mtr.get_raw_position(NULL) <= lower && voltage <= 0){
+        mtr.move_voltage(correctionVoltage);
+    }else if(mtr.get_raw_position(NULL) >= upper && voltage >= 0){
+        mtr.move_voltage(-correctionVoltage);
     }else{
-        mtr = speed;
+        mtr.move_voltage(voltage);
     }
 }
 
-void Robot::drive(double distance, int speed){
-    left_drive1.tare_position();
-    left_drive2.tare_position();
-    right_drive1.tare_position();
-    right_drive2.tare_position();
+void Robot::drive(double distance, int voltage){
+    float kHeading = 95;    //mV per degree of heading error
+    std::uint32_t mark = beginMove();
 
-    double heading = imu.get_rotation();
+    //the encoders aren't tared so odometry keeps a continuous count
+    double start = getDriveDistance();
+
+    double heading = getRotation();
     while(heading == INFINITY){
         pros::delay(25);
-        heading = imu.get_rotation();
+        heading = getRotation();
     }
 
     int target = distance * ticksPerFoot;
     double traveled = 0;
-    while(abs(target) > fabs(traveled)){
-        traveled = (left_drive1.get_position() + left_drive2.get_position() +
-                    right_drive1.get_position() + right_drive1.get_position())/4;
-        pros::lcd::print(0, "%f", traveled);
-        double error = heading - imu.get_rotation();
-        setDriveSpeed(speed + error, speed - error);
-        pros::delay(25);
+    driveLoop.reset();
+    while(abs(target) > fabs(traveled) && !stopRequested(mark)){
+        SensorState state = getSensors();
+        traveled = ((state.leftDistance + state.rightDistance) / 2 - start) * ticksPerFoot;
+        motion.progress = traveled / ticksPerFoot;
+        double correction = kHeading * (heading - state.rotation);
+        setDriveVoltage(voltage + correction, voltage - correction);
+        driveLoop.wait();
     }
 
-    setDriveSpeed(0);
+    setDriveVoltage(0);
 }
 
-void Robot::turn(double degrees){
-    float kp = 1;
-    float kd = 5;
-    float ki = .1;
-    float kScale = 1;
-
-    float drivevolt = 0;
-    float mindrivevolt = 30;
-    float maxdrivevolt = 110;
-
-    double error;
-    double prevError;
-    double derivative;
-    double integral = 0;
-    while(fabs(imu.get_rotation() - degrees) > 1){
-        error = degrees - imu.get_rotation();
-        derivative = error - prevError;
-        prevError = error;
+//average travel of the four drive encoders since startup, in feet
+double Robot::getDriveDistance(){
+    return (getLeftDistance() + getRightDistance()) / 2;
+}
 
-        drivevolt = kScale * (error * kp + derivative * kd + integral * ki);
+double Robot::getLeftDistance(){
+    return sensors.read().leftDistance;
+}
+
+double Robot::getRightDistance(){
+    return sensors.read().rightDistance;
+}
+
+//latest sample from the sensor task
+SensorState Robot::getSensors(){
+    return sensors.read();
+}
 
-        //give a mininum driving voltage
-        if(-mindrivevolt < drivevolt && drivevolt < 0){
-            drivevolt = -mindrivevolt;
+double Robot::getRotation(){
+    return sensors.read().rotation;
+}
+
+Pose Robot::getPose(){
+    return odom.getPose();
+}
+
+void Robot::setPose(Pose pose){
+    odom.setPose(pose);
+}
+
+//how the last turn or profiled drive went, for tuning
+MoveScore Robot::getLastScore(){
+    return lastScore;
+}
+
+//writes the tunable gains and drive model as text, one controller per line.
+//the first line records the output scale the pid gains were found at
+bool Robot::saveGains(std::string path){
+    FILE *file = fopen(path.c_str(), "w");
+    if(file == nullptr){
+        return false;
+    }
+    fprintf(file, "scale %d 0 0\n", MAX_VOLTAGE);
+    for(std::size_t i = 0; i < turnPID.getStageCount(); i++){
+        PIDGains gains = turnPID.getGains(i);
+        fprintf(file, "turn%d %f %f %f\n", (int)i, gains.kP, gains.kI, gains.kD);
+    }
+    fprintf(file, "drive %f %f %f\n", driveGains.kP, driveGains.kI, driveGains.kD);
+    fprintf(file, "ffleft %f %f %f\n", leftFeedforward.kS, leftFeedforward.kV, leftFeedforward.kA);
+    fprintf(file, "ffright %f %f %f\n", rightFeedforward.kS, rightFeedforward.kV, rightFeedforward.kA);
+    fclose(file);
+    return true;
+}
+
+//loads gains written by saveGains, lines it doesn't recognise are skipped.
+//files from before the outputs were in millivolts have no scale line, their
+//pid gains are on the 127 scale and get converted
+bool Robot::loadGains(std::string path){
+    FILE *file = fopen(path.c_str(), "r");
+    if(file == nullptr){
+        return false;
+    }
+    char name[16];
+    double a, b, c;
+    int stage;
+    double scale = MAX_VOLTAGE / 127.0;
+    while(fscanf(file, "%15s %lf %lf %lf", name, &a, &b, &c) == 4){
+        if(strcmp(name, "scale") == 0 && a > 0){
+            scale = MAX_VOLTAGE / a;
+        }else if(strcmp(name, "drive") == 0){
+            driveGains = {a * scale, b * scale, c * scale};
+        }else if(strcmp(name, "ffleft") == 0){
+            leftFeedforward = {a, b, c};
+        }else if(strcmp(name, "ffright") == 0){
+            rightFeedforward = {a, b, c};
+        }else if(sscanf(name, "turn%d", &stage) == 1 && stage >= 0){
+            turnPID.setGains(stage, {a * scale, b * scale, c * scale});
         }
+    }
+    fclose(file);
+    return true;
+}
+
+//the blackbox logs the sticks from here, so a replay records what was
+//replayed and not the live controller. null goes back to the controller
+void Robot::setInput(ControllerInput *source){
+    input = source;
+}
+
+//body of the sensor task. every device is read exactly once per tick and
+//odometry is updated from the same sample
+void Robot::sampleSensors(){
+    //temperatures barely move, one motor a sample keeps the tick short
+    pros::Motor *motors[8] = {&left_drive1, &right_drive1, &left_drive2, &right_drive2,
+                              &left_intake, &right_intake, &roller1, &roller2};
+    SensorState last;
+    sensorLoop.reset();
+    while(true){
+        SensorState state;
+        std::copy(last.temperatures, last.temperatures + 8, state.temperatures);
+        int hot = sensorLoop.getIterations() % 8;
+        state.temperatures[hot] = motors[hot]->get_temperature();
+        state.time = pros::millis();
+        state.leftDistance = (left_drive1.get_position() + left_drive2.get_position()) / 2 / ticksPerFoot;
+        state.rightDistance = (right_drive1.get_position() + right_drive2.get_position()) / 2 / ticksPerFoot;
+        state.leftVelocity = left_drive1.get_actual_velocity();
+        state.rightVelocity = right_drive1.get_actual_velocity();
+        state.leftCurrent = left_drive1.get_current_draw();
+        state.rightCurrent = right_drive1.get_current_draw();
+        state.rotation = imu.get_rotation();
+        state.frontLimit = front_limitswitch.get_value() == 1;
+        sensors.write(state);
+        last = state;
 
-        if(0 < drivevolt && drivevolt < mindrivevolt){
-            drivevolt = mindrivevolt;
+        odom.update(state.leftDistance, state.rightDistance, state.rotation);
+
+        //every other sample, 100 records a second
+        if(sensorLoop.getIterations() % 2 == 0){
+            Pose pose = odom.getPose();
+            TelemetryRecord record = {state.time, (float)pose.x, (float)pose.y, (float)pose.theta,
+                                      (std::int16_t)output.getTarget(left_drive1),
+                                      (std::int16_t)output.getTarget(right_drive1),
+                                      (float)state.leftVelocity, (float)state.rightVelocity,
+                                      (std::int16_t)state.leftCurrent, (std::int16_t)state.rightCurrent};
+            telemetry.push(record);
+
+            BlackBoxRecord entry = {state.time, pros::competition::get_status(),
+                                    {},
+                                    record.leftVoltage, record.rightVoltage,
+                                    (float)state.leftDistance, (float)state.rightDistance, (float)state.rotation, {}};
+            ControllerInput *source = input;
+            if(source != nullptr){
+                source->getAxes(entry.axes);
+            }else{
+                entry.axes[0] = controller.get_analog(ANALOG_LEFT_X);
+                entry.axes[1] = controller.get_analog(ANALOG_LEFT_Y);
+                entry.axes[2] = controller.get_analog(ANALOG_RIGHT_X);
+                entry.axes[3] = controller.get_analog(ANALOG_RIGHT_Y);
+            }
+            for(int i = 0; i < 8; i++){
+                entry.temperature[i] = trim(state.temperatures[i], 0, 255);
+            }
+            blackbox.push(entry);
         }
+        sensorLoop.wait();
+    }
+}
 
-        drivevolt = trim(drivevolt, -maxdrivevolt, maxdrivevolt);
+//jerk limited straight drive, the acceleration ramps in and out smoothly
+void Robot::driveSProfile(double distance){
+    driveProfile(MotionProfile(distance, driveLimits, ProfileShape::sCurve));
+}
 
-        setDriveSpeed(drivevolt, -drivevolt);
+//straight drive with half cosine speed up and slow down
+void Robot::driveSineProfile(double distance){
+    driveProfile(MotionProfile(distance, driveLimits, ProfileShape::sine));
+}
+
+//follows the profile with velocity/acceleration feedforward plus position and
+//heading feedback, then holds position until the robot has stopped on target
+void Robot::driveProfile(MotionProfile profile){
+    float kHeading = 95;           //mV per degree of heading error
+    float maxIntegral = 2800;      //mV the integral term can add
+    double settleError = 1.0 / 48; //ft
+    std::uint32_t settleTimeout = 1000;
+    PIDGains gains = driveGains;
+    std::uint32_t mark = beginMove();
+
+    //the encoders aren't tared so odometry keeps a continuous count
+    double start = getDriveDistance();
+    double lastError = 0;
+    double integral = 0;
+    lastScore = {0, 0};
+    double moveSize = fmax(fabs(profile.getDistance()), settleError);
+
+    double heading = getRotation();
+    while(heading == INFINITY){
+        pros::delay(25);
+        heading = getRotation();
+    }
+
+    std::uint32_t startTime = pros::millis();
+    std::uint32_t profileEnd = startTime + profile.getDuration() * 1000;
+    driveLoop.reset();
+    while(!stopRequested(mark)){
+        std::uint32_t now = pros::millis();
+        ProfileState target = profile.get((now - startTime) / 1000.0);
+        SensorState state = getSensors();
+        double traveled = (state.leftDistance + state.rightDistance) / 2 - start;
+        double error = target.position - traveled;
+        motion.progress = traveled;
+        lastScore.itae += (now - startTime) / 1000.0 * fabs(error) / moveSize * driveLoop.getPeriod() / 1000.0;
+
+        if(now >= profileEnd){
+            bool stopped = fabs(state.leftVelocity) < 5 && fabs(state.rightVelocity) < 5;
+            if((fabs(error) < settleError && stopped) || now - profileEnd > settleTimeout){
+                break;
+            }
+        }
 
-        pros::delay(10);
+        if(gains.kI != 0){
+            integral = fmin(fmax(integral + error, -maxIntegral / fabs(gains.kI)), maxIntegral / fabs(gains.kI));
+        }
+        double feedback = gains.kP * error + gains.kI * integral + gains.kD * (error - lastError);
+        lastError = error;
 
+        //the command holds until the next tick, so feed forward where the
+        //profile will be then
+        ProfileState next = profile.get((now - startTime + driveLoop.getPeriod()) / 1000.0);
+        double left = leftFeedforward(next.velocity, next.acceleration) + feedback;
+        double right = rightFeedforward(next.velocity, next.acceleration) + feedback;
+        if(target.velocity == 0 && fabs(error) > settleError){
+            left += error > 0 ? leftFeedforward.kS : -leftFeedforward.kS;
+            right += error > 0 ? rightFeedforward.kS : -rightFeedforward.kS;
+        }
+        double correction = kHeading * (heading - state.rotation);
+        setDriveVoltage(left + correction, right - correction);
+        driveLoop.wait();
     }
-    kp = 3.0;
-    kd = .32;
-    ki = .04;
-    kScale = 2.1;
-
-    integral = 0;
-    int minCorrectionLoops = 10;//ensure a minimum number of correction loops
-    while(fabs(imu.get_rotation() - degrees) > 1 || minCorrectionLoops > 0) {
-        minCorrectionLoops -= 1;
-
-        error = degrees - imu.get_rotation();
-        derivative = error - prevError;
-        prevError = error;
-
-        if((fabs(error) < 10)){
-            integral += error;
-        }else{
-            //integral = 0;
+
+    setDriveVoltage(0);
+    lastScore.settleTime = (pros::millis() - startTime) / 1000.0;
+}
+
+//measures each side of the drive and fits leftFeedforward and rightFeedforward.
+//a slow voltage ramp shows static friction and the velocity term, a step
+//shows the acceleration term. each runs forwards then backwards so the robot
+//ends up about where it started, it needs around 3 ft of room in front.
+//returns false, leaving the old model, if either fit failed
+bool Robot::characterize(){
+    //a bench run, not a match one, its sample buffers come from the heap
+    heapguard::Unlocked unlocked;
+    std::uint32_t mark = beginMove();
+    const double rampRate = 1500;           //mV/s
+    const std::uint32_t rampTime = 3000;    //ms
+    const double stepVoltage = 7000;        //mV
+    const std::uint32_t stepTime = 600;     //ms
+    const std::uint32_t restTime = 800;     //ms to let the robot stop between runs
+    double rpmToFps = 900.0 / 60 / ticksPerFoot;
+
+    std::vector<DriveSample> leftSamples;
+    std::vector<DriveSample> rightSamples;
+    auto run = [&](bool ramp, int direction){
+        std::vector<DriveSample> left;
+        std::vector<DriveSample> right;
+        std::vector<double> times;
+        std::uint32_t length = ramp ? rampTime : stepTime;
+        std::uint32_t startTime = pros::millis();
+        driveLoop.reset();
+        while(pros::millis() - startTime < length && !stopRequested(mark)){
+            SensorState state = getSensors();
+            double elapsed = (pros::millis() - startTime) / 1000.0;
+            setDriveVoltage(direction * (ramp ? rampRate * elapsed : stepVoltage));
+
+            //the latest sample can be a few ms older than the run, that one
+            //still belongs to the rest before it
+            std::int32_t age = (std::int32_t)(state.time - startTime);
+            if(age >= 0){
+                double t = age / 1000.0;
+                double voltage = direction * (ramp ? rampRate * t : stepVoltage);
+                left.push_back({voltage, state.leftVelocity * rpmToFps, 0});
+                right.push_back({voltage, state.rightVelocity * rpmToFps, 0});
+                times.push_back(t);
+            }
+            driveLoop.wait();
         }
+        setDriveVoltage(0);
 
-        drivevolt = kScale * (error * kp + derivative * kd + integral * ki);
-        drivevolt = trim(drivevolt, -maxdrivevolt, maxdrivevolt);
+        //central difference, the end samples have no neighbour and are dropped
+        for(std::size_t i = 1; i + 1 < times.size(); i++){
+            double dt = times[i + 1] - times[i - 1];
+            if(dt > 0){
+                left[i].acceleration = (left[i + 1].velocity - left[i - 1].velocity) / dt;
+                right[i].acceleration = (right[i + 1].velocity - right[i - 1].velocity) / dt;
+                leftSamples.push_back(left[i]);
+                rightSamples.push_back(right[i]);
+            }
+        }
+        pros::delay(restTime);
+    };
+    run(true, 1);
+    run(true, -1);
+    run(false, 1);
+    run(false, -1);
+    if(stopRequested(mark)){
+        return false;
+    }
 
-        setDriveSpeed(drivevolt, -drivevolt);
-        pros::delay(10);
+    Feedforward left;
+    Feedforward right;
+    if(!fitFeedforward(leftSamples, left) || !fitFeedforward(rightSamples, right)){
+        printf("characterize: fit failed\n");
+        return false;
     }
-    setDriveSpeed(0);
+    printf("characterize: left kS %.0f kV %.0f kA %.0f, right kS %.0f kV %.0f kA %.0f\n",
+           left.kS, left.kV, left.kA, right.kS, right.kV, right.kA);
+    leftFeedforward = left;
+    rightFeedforward = right;
+    return true;
+}
+
+//turns to an absolute imu heading. gains are scheduled on the error: a soft
+//stage with a minimum output swings the robot most of the way, a stiffer one
+//with integral pulls it in. ends once turnPID reports settled
+void Robot::turn(double degrees){
+    std::uint32_t timeout = 3000;
+    std::uint32_t mark = beginMove();
+
+    double rotation = getRotation();
+    while(rotation == INFINITY){
+        pros::delay(25);
+        rotation = getRotation();
+    }
+
+    double startHeading = rotation;
+    turnPID.reset(rotation);
+    lastScore = {0, 0};
+    double moveSize = fmax(fabs(degrees - startHeading), 1);
+    std::uint32_t startTime = pros::millis();
+    turnLoop.reset();
+    while(pros::millis() - startTime < timeout && !stopRequested(mark)){
+        double output = turnPID.step(degrees, rotation);
+        motion.progress = rotation - startHeading;
+        lastScore.itae += (pros::millis() - startTime) / 1000.0 * fabs(turnPID.getError()) / moveSize * turnLoop.getPeriod() / 1000.0;
+        if(turnPID.isSettled()){
+            break;
+        }
+        setDriveVoltage(output, -output);
+        turnLoop.wait();
+        rotation = getRotation();
+    }
+    setDriveVoltage(0);
+    lastScore.settleTime = (pros::millis() - startTime) / 1000.0;
 
     /*
     double heading = imu.get_rotation();
@@ -296,9 +718,327 @@ void Robot::turn(double degrees){
         heading = imu.get_rotation();
         double minCorrection = 0;//target > heading ? 10 : -10;
         double correction = trim((target - heading) * 5 + minCorrection, -maxSpeed, maxSpeed);
-        setDriveSpeed(correction, -correction);
+        setDriveVoltage(correction, -correction);
     }
 
-    setDriveSpeed(0);
+    setDriveVoltage(0);
     */
 }
+
+//turn in place to face a field point
+void Robot::turnToPoint(double x, double y){
+    double rotation = getRotation();
+    while(rotation == INFINITY){
+        pros::delay(25);
+        rotation = getRotation();
+    }
+    turn(rotation + angleToPoint(getPose(), x, y));
+}
+
+//drives to a field point in one motion, ending at whatever heading the
+//approach left it at
+void Robot::driveToPoint(double x, double y, int maxVoltage){
+    moveToPoint(x, y, NAN, maxVoltage);
+}
+
+//drives to a field point and arrives facing the given field heading
+void Robot::driveToPose(double x, double y, double heading, int maxVoltage){
+    moveToPoint(x, y, heading, maxVoltage);
+}
+
+//forward speed is scaled by how well the robot faces where it is going, so a
+//big heading error turns mostly in place and the robot curves in as the error
+//shrinks instead of stopping between a turn and a drive. with a final heading
+//it steers at a carrot point behind the target along that heading
+//(boomerang), which pulls the approach around to line up
+void Robot::moveToPoint(double x, double y, double heading, int maxVoltage){
+    float kLinear = 7600;                       //mV per ft
+    float kAngular = 190;                       //mV per degree
+    float kS = 1900;                            //minimum forward mV so the approach never stalls
+    float maxRamp = MAX_VOLTAGE * 10 / 250.0;   //forward mV change per 10ms tick
+    double lead = 0.6;                  //carrot distance as a fraction of distance left
+    double settleDistance = 1.0 / 12;   //ft
+    double headingLockDistance = 0.5;   //ft, heading to the point is noise when this close
+    std::uint32_t timeout = 5000;
+    bool hasHeading = !isnan(heading);
+    std::uint32_t mark = beginMove();
+
+    Pose start = getPose();
+    double total = distanceToPoint(start, x, y);
+    double linear = 0;
+    std::uint32_t startTime = pros::millis();
+    driveLoop.reset();
+    while(pros::millis() - startTime < timeout && !stopRequested(mark)){
+        Pose pose = getPose();
+        double distance = distanceToPoint(pose, x, y);
+        motion.progress = total - distance;
+
+        double carrotX = x;
+        double carrotY = y;
+        if(hasHeading){
+            carrotX -= lead * distance * cos(heading * M_PI / 180);
+            carrotY -= lead * distance * sin(heading * M_PI / 180);
+        }
+        double angle = angleToPoint(pose, carrotX, carrotY);
+
+        //distance left along the direction the robot is facing, goes negative
+        //once the point is behind it
+        double along = distance * cos(angleToPoint(pose, x, y) * M_PI / 180);
+        if(distance < settleDistance || (distance < headingLockDistance && along <= 0)){
+            break;
+        }
+
+        double targetLinear = trim(kLinear * along, -maxVoltage, maxVoltage);
+        if(distance >= headingLockDistance && fabs(angle) > 90){
+            targetLinear = 0;
+        }
+        if(targetLinear > 0 && targetLinear < kS){
+            targetLinear = kS;
+        }
+        linear = trim(targetLinear, linear - maxRamp, linear + maxRamp);
+
+        double angular = kAngular * angle;
+        if(distance < headingLockDistance){
+            angular = hasHeading ? kAngular * constrainAngle180(heading - pose.theta) : 0;
+        }
+        setDriveVoltage(linear + angular, linear - angular);
+        driveLoop.wait();
+    }
+
+    setDriveVoltage(0);
+}
+
+//follows the waypoints with pure pursuit, top speed is what maxVoltage holds
+void Robot::followPath(const std::vector<Waypoint> &path, int maxVoltage){
+    float kV = MAX_VOLTAGE / freeSpeed; //mV per ft/s
+    float kS = 760;                     //mV to overcome static friction
+    double rpmToFps = 900.0 / 60 / ticksPerFoot;
+    std::uint32_t mark = beginMove();
+
+    //plans the end slowdown at half the drive acceleration since the wheels lag the command
+    PursuitLimits limits = {freeSpeed * abs(maxVoltage) / MAX_VOLTAGE, driveLimits.acceleration / 2, 3, 0.75, 2, 0.4};
+    //beginMove() keeps follows from overlapping, the lease makes sure of it
+    //before anything is built in the shared path memory
+    ArenaLease lease(pathArena);
+    if(!lease.isHeld()){
+        printf("followPath: path memory in use, move skipped\n");
+        return;
+    }
+    PurePursuit pursuit(path, limits, trackWidth, pathArena);
+    std::uint32_t timeout = (pursuit.getLength() / limits.velocity * 2 + 2) * 1000;
+
+    std::uint32_t startTime = pros::millis();
+    driveLoop.reset();
+    while(pros::millis() - startTime < timeout && !stopRequested(mark)){
+        SensorState state = getSensors();
+        double velocity = (state.leftVelocity + state.rightVelocity) / 2 * rpmToFps;
+        PursuitCommand command = pursuit.step(getPose(), velocity);
+        motion.progress = pursuit.getProgress();
+        if(command.finished){
+            break;
+        }
+
+        double left = kV * command.left;
+        double right = kV * command.right;
+        left += left > 0 ? kS : (left < 0 ? -kS : 0);
+        right += right > 0 ? kS : (right < 0 ? -kS : 0);
+        setDriveVoltage(left, right);
+        driveLoop.wait();
+    }
+
+    setDriveVoltage(0);
+}
+
+//plays back a precomputed tank trajectory, each side gets the same
+//feedforward and position feedback as driveProfile. the trajectory's heading
+//is relative to where the robot faces when it starts
+void Robot::followTrajectory(Trajectory trajectory){
+    float kP = 8500;               //mV per ft of position error
+    float kHeading = 570;          //mV per degree, stiffer than driveProfile since curves scrub
+    double settleError = 1.0 / 48; //ft
+    std::uint32_t settleTimeout = 1000;
+    std::uint32_t mark = beginMove();
+
+    if(trajectory.length < 1){
+        return;
+    }
+
+    double leftStart = getLeftDistance();
+    double rightStart = getRightDistance();
+
+    double heading = getRotation();
+    while(heading == INFINITY){
+        pros::delay(25);
+        heading = getRotation();
+    }
+    heading -= trajectory.left[0].heading;
+
+    std::uint32_t period = trajectory.left[0].dt * 1000;
+    std::uint32_t startTime = pros::millis();
+    std::uint32_t end = startTime + (trajectory.length - 1) * period;
+    driveLoop.reset();
+    while(!stopRequested(mark)){
+        std::uint32_t now = pros::millis();
+        int i = min((int)((now - startTime) / period), trajectory.length - 1);
+        const TrajectorySegment &left = trajectory.left[i];
+        const TrajectorySegment &right = trajectory.right[i];
+        SensorState state = getSensors();
+        double leftError = left.position - (state.leftDistance - leftStart);
+        double rightError = right.position - (state.rightDistance - rightStart);
+        motion.progress = (left.position + right.position) / 2;
+
+        if(now >= end){
+            bool stopped = fabs(state.leftVelocity) < 5 && fabs(state.rightVelocity) < 5;
+            bool onTarget = fabs(leftError) < settleError && fabs(rightError) < settleError;
+            if((onTarget && stopped) || now - end > settleTimeout){
+                break;
+            }
+        }
+
+        //feed forward the segment the command will be holding through
+        int next = min(i + 1, trajectory.length - 1);
+        const TrajectorySegment &leftNext = trajectory.left[next];
+        const TrajectorySegment &rightNext = trajectory.right[next];
+        double leftOutput = leftFeedforward(leftNext.velocity, leftNext.acceleration) + kP * leftError;
+        double rightOutput = rightFeedforward(rightNext.velocity, rightNext.acceleration) + kP * rightError;
+        if(left.velocity == 0 && fabs(leftError) > settleError){
+            leftOutput += leftError > 0 ? leftFeedforward.kS : -leftFeedforward.kS;
+        }
+        if(right.velocity == 0 && fabs(rightError) > settleError){
+            rightOutput += rightError > 0 ? rightFeedforward.kS : -rightFeedforward.kS;
+        }
+        double correction = kHeading * (heading + left.heading - state.rotation);
+        setDriveVoltage(leftOutput + correction, rightOutput - correction);
+        driveLoop.wait();
+    }
+
+    setDriveVoltage(0);
+}
+
+AsyncMotion Robot::driveAsync(double distance, int voltage){
+    return startMotion(MotionType::drive, distance, 0, 0, voltage);
+}
+
+AsyncMotion Robot::driveSProfileAsync(double distance){
+    return startMotion(MotionType::sProfile, distance, 0, 0, 0);
+}
+
+AsyncMotion Robot::driveSineProfileAsync(double distance){
+    return startMotion(MotionType::sineProfile, distance, 0, 0, 0);
+}
+
+AsyncMotion Robot::turnAsync(double degrees){
+    return startMotion(MotionType::turn, degrees, 0, 0, 0);
+}
+
+//wait for the last async move to finish
+void Robot::waitUntilSettled(){
+    AsyncMotion(&motion, motion.issued).waitUntilSettled();
+}
+
+AsyncMotion Robot::driveToPointAsync(double x, double y, int maxVoltage){
+    return startMotion(MotionType::driveToPoint, x, y, 0, maxVoltage);
+}
+
+AsyncMotion Robot::driveToPoseAsync(double x, double y, double heading, int maxVoltage){
+    return startMotion(MotionType::driveToPose, x, y, heading, maxVoltage);
+}
+
+AsyncMotion Robot::followPathAsync(const std::vector<Waypoint> &path, int maxVoltage){
+    waitUntilSettled();
+    pendingPath.assign(path.begin(), path.end());
+    return startMotion(MotionType::followPath, 0, 0, 0, maxVoltage);
+}
+
+AsyncMotion Robot::followTrajectoryAsync(Trajectory trajectory){
+    waitUntilSettled();
+    pendingTrajectory = trajectory;
+    return startMotion(MotionType::followTrajectory, 0, 0, 0, 0);
+}
+
+//ends the move in progress, whichever task is running it, and stops the
+//drive. returns once the motion task is idle
+void Robot::stop(){
+    stops++;
+    waitUntilSettled();
+    releasePaths();
+    setDriveVoltage(0);
+}
+
+//every move starts here. one from outside the motion task waits out the
+//async move first, so two loops never drive at once. the result is checked
+//with stopRequested() each tick
+std::uint32_t Robot::beginMove(){
+    if(motionTask != nullptr && pros::c::task_get_current() == (pros::task_t)*motionTask){
+        return pendingStops;
+    }
+    waitUntilSettled();
+    releasePaths();
+    return stops;
+}
+
+//with no move running nobody is following a path, a lease still out was
+//held by a task the kernel deleted mid follow and its destructor never ran
+void Robot::releasePaths(){
+    pathArena.release();
+}
+
+bool Robot::stopRequested(std::uint32_t mark){
+    return stops != mark;
+}
+
+AsyncMotion Robot::startMotion(MotionType type, double target, double y, double heading, int voltage){
+    waitUntilSettled();
+    //nothing runs async moves before initialize() starts the motion task
+    if(motionTask == nullptr){
+        return AsyncMotion(&motion, motion.finished);
+    }
+
+    pendingType = type;
+    pendingTarget = target;
+    pendingY = y;
+    pendingHeading = heading;
+    pendingVoltage = voltage;
+    pendingStops = stops;
+    motion.progress = 0;
+    std::uint32_t id = motion.issued + 1;
+    motion.issued = id;
+    motionTask->notify();
+    return AsyncMotion(&motion, id);
+}
+
+//body of the motion task, runs each issued move to completion
+void Robot::motionLoop(){
+    while(true){
+        pros::c::task_notify_take(true, TIMEOUT_MAX);
+        while(motion.finished < motion.issued){
+            switch(pendingType){
+                case MotionType::drive:
+                    drive(pendingTarget, pendingVoltage);
+                    break;
+                case MotionType::sProfile:
+                    driveSProfile(pendingTarget);
+                    break;
+                case MotionType::sineProfile:
+                    driveSineProfile(pendingTarget);
+                    break;
+                case MotionType::turn:
+                    turn(pendingTarget);
+                    break;
+                case MotionType::driveToPoint:
+                    driveToPoint(pendingTarget, pendingY, pendingVoltage);
+                    break;
+                case MotionType::driveToPose:
+                    driveToPose(pendingTarget, pendingY, pendingHeading, pendingVoltage);
+                    break;
+                case MotionType::followPath:
+                    followPath(pendingPath, pendingVoltage);
+                    break;
+                case MotionType::followTrajectory:
+                    followTrajectory(pendingTrajectory);
+                    break;
+            }
+            motion.finished = motion.issued.load();
+        }
+    }
+}
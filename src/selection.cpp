@@ -2,6 +2,7 @@
 #include "selection.h"
 
 static const char *btnmMap[] = {"Front", "Back", "Do Nothing", ""};
+static const char *tuneBtnmMap[] = {"Autotune", "Characterize", ""};
 
 /*Create a button descriptor string array*/
 int autonSelection = 3;
@@ -40,6 +41,17 @@ lv_res_t skillsBtnAction(lv_obj_t *btn){
 	return LV_RES_OK;
 }
 
+lv_res_t tuneBtnmAction(lv_obj_t *btnm, const char *txt){
+	printf("tune button: %s released\n", txt);
+	if (strcmp(txt, "Autotune") == 0){
+		autonSelection = 4;
+	}
+	if (strcmp(txt, "Characterize") == 0){
+		autonSelection = 5;
+	}
+	return LV_RES_OK;
+}
+
 void selectorInit(){
 	// lvgl theme
 	lv_theme_t *th = lv_theme_alien_init(360, NULL); //Set a HUE value and keep font default RED
@@ -49,10 +61,11 @@ void selectorInit(){
 	lv_obj_t *tabview;
 	tabview = lv_tabview_create(lv_scr_act(), NULL);
 
-	// add 3 tabs (the tabs are page (lv_page) and can be scrolled
+	// add 4 tabs (the tabs are page (lv_page) and can be scrolled
 	lv_obj_t *redTab = lv_tabview_add_tab(tabview, "Red");
 	lv_obj_t *blueTab = lv_tabview_add_tab(tabview, "Blue");
 	lv_obj_t *skillsTab = lv_tabview_add_tab(tabview, "Skills");
+	lv_obj_t *tuneTab = lv_tabview_add_tab(tabview, "Tune");
 
 	// add content to the tabs
 	// button matrix
@@ -82,4 +95,12 @@ void selectorInit(){
 	lv_obj_set_size(skillsBtn, 450, 50);
 	lv_obj_set_pos(skillsBtn, 0, 100);
 	lv_obj_align(skillsBtn, NULL, LV_ALIGN_CENTER, 0, 0);
+
+	// tune tab, runs autotune() or characterize() in place of an autonomous routine
+	lv_obj_t *tuneBtnm = lv_btnm_create(tuneTab, NULL);
+	lv_btnm_set_map(tuneBtnm, tuneBtnmMap);
+	lv_btnm_set_action(tuneBtnm, tuneBtnmAction);
+	lv_obj_set_size(tuneBtnm, 450, 50);
+	lv_obj_set_pos(tuneBtnm, 0, 100);
+	lv_obj_align(tuneBtnm, NULL, LV_ALIGN_CENTER, 0, 0);
 }
@@ -0,0 +1,23 @@
+#ifndef SENSORSTATE_HPP
+#define SENSORSTATE_HPP
+
+#include <math.h>
+#include <cstdint>
+
+//every sensor the robot reads, sampled together once per tick by the sensor
+//task. control code reads the latest one instead of asking the devices, so
+//everything in a tick sees the same numbers
+struct SensorState{
+    std::uint32_t time = 0;         //ms, when the sample was taken
+    double leftDistance = 0;        //ft, average of the left drive encoders
+    double rightDistance = 0;
+    double leftVelocity = 0;        //rpm, left_drive1
+    double rightVelocity = 0;       //rpm, right_drive1
+    int leftCurrent = 0;            //mA, left_drive1
+    int rightCurrent = 0;           //mA, right_drive1
+    double temperatures[8] = {};    //C, in MotorOutput order, one refreshed per sample
+    double rotation = INFINITY;     //deg, imu, INFINITY while it has no reading
+    bool frontLimit = false;
+};
+
+#endif
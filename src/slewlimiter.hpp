@@ -0,0 +1,72 @@
+#ifndef SLEWLIMITER_HPP
+#define SLEWLIMITER_HPP
+
+#include <math.h>
+#include <cstdint>
+#include "main.h"
+
+//rate limit for one output channel. rates are in units per second, rise
+//while the magnitude grows and fall while it shrinks, so the ramp depends on
+//real time and not on how often step() is called. a reversal falls to zero
+//and then rises the other way
+class SlewLimiter{
+    public:
+        SlewLimiter(double, double);
+        double step(double);
+        double step(double, double);
+        void reset(double = 0);
+        void setRates(double, double);
+        double get();
+
+    private:
+        static constexpr double maxDt = 0.1;    //s, longer gaps count as this so a stall can't jump the output
+
+        double rise;
+        double fall;
+        double value;
+        std::uint32_t lastTime;
+};
+
+inline SlewLimiter::SlewLimiter(double riseRate, double fallRate){
+    rise = riseRate;
+    fall = fallRate;
+    value = 0;
+    lastTime = 0;
+}
+
+//dt measured since the last call, the first call after a reset doesn't move
+inline double SlewLimiter::step(double target){
+    std::uint32_t now = pros::millis();
+    double dt = lastTime == 0 ? 0 : (now - lastTime) / 1000.0;
+    lastTime = now;
+    return step(target, dt);
+}
+
+//dt in seconds
+inline double SlewLimiter::step(double target, double dt){
+    dt = fmin(fmax(dt, 0), maxDt);
+    if(value != 0 && (target == 0 || (target > 0) != (value > 0) || fabs(target) < fabs(value))){
+        //shrinking, stop at zero when reversing and rise from there next time
+        double floor = (target > 0) == (value > 0) ? target : 0;
+        value = value > 0 ? fmax(value - fall * dt, floor) : fmin(value + fall * dt, floor);
+    }else{
+        value = target > value ? fmin(value + rise * dt, target) : fmax(value - rise * dt, target);
+    }
+    return value;
+}
+
+inline void SlewLimiter::reset(double start){
+    value = start;
+    lastTime = 0;
+}
+
+inline void SlewLimiter::setRates(double riseRate, double fallRate){
+    rise = riseRate;
+    fall = fallRate;
+}
+
+inline double SlewLimiter::get(){
+    return value;
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <atomic>
+#include <cstdint>
+
+//latest value of something one task produces and any number of tasks read,
+//without a mutex. the writer fills whichever of the two buffers readers are
+//not pointed at and then flips the index, readers retry only if the writer
+//lapped them mid copy. only one task may call write()
+template <typename T>
+class Snapshot{
+    public:
+        Snapshot();
+        void write(const T&);
+        T read();
+        std::uint32_t getVersion();
+
+    private:
+        T buffers[2];
+        std::atomic<std::uint32_t> sequence[2];
+        std::atomic<std::uint32_t> index;
+        std::atomic<std::uint32_t> version;
+};
+
+template <typename T>
+Snapshot<T>::Snapshot() : buffers{}, sequence{{0}, {0}}, index{0}, version{0}{}
+
+template <typename T>
+void Snapshot<T>::write(const T &value){
+    std::uint32_t next = index.load() ^ 1;
+    sequence[next].fetch_add(1);    //odd while the copy is in progress
+    std::atomic_thread_fence(std::memory_order_release);
+    buffers[next] = value;
+    std::atomic_thread_fence(std::memory_order_release);
+    sequence[next].fetch_add(1);
+    index.store(next);
+    version.fetch_add(1);
+}
+
+template <typename T>
+T Snapshot<T>::read(){
+    while(true){
+        std::uint32_t i = index.load();
+        std::uint32_t before = sequence[i].load();
+        if(before & 1){
+            continue;
+        }
+        T value = buffers[i];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(sequence[i].load() == before){
+            return value;
+        }
+    }
+}
+
+//number of writes so far, lets readers tell whether anything new arrived
+template <typename T>
+std::uint32_t Snapshot<T>::getVersion(){
+    return version.load();
+}
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef STATUSDISPLAY_HPP
+#define STATUSDISPLAY_HPP
+
+#include <cstdint>
+#include <functional>
+#include "main.h"
+#include "pros/apix.h"
+#include "sensorstate.hpp"
+
+//what the driver control loop hands the screen each tick
+struct DriverStatus{
+    SensorState sensors;
+    std::uint32_t maxBusy;      //ms, driver loop
+    std::uint32_t overruns;
+    std::uint32_t maxJitter;    //ms
+};
+
+//screen and controller feedback in their own task at the lowest priority, so
+//a slow lcd write or rumble never stretches a control period. the control
+//loop posts into a one slot queue that always holds the newest status, and
+//notifies the task for an alert so it doesn't wait out the rest of the period.
+//alerts are bits, any raised since the last wake are handed over together
+class StatusDisplay{
+    public:
+        StatusDisplay(std::function<void(const DriverStatus&)>, std::function<void(std::uint32_t)>, std::uint32_t);
+        void start();
+        void post(const DriverStatus&);
+        void alert(std::uint32_t);
+
+    private:
+        void run();
+
+        std::function<void(const DriverStatus&)> show;
+        std::function<void(std::uint32_t)> onAlert;
+        std::uint32_t period;   //ms between screen updates
+        pros::c::queue_t queue;
+        pros::Task *task;
+};
+
+inline StatusDisplay::StatusDisplay(std::function<void(const DriverStatus&)> showStatus,
+                                    std::function<void(std::uint32_t)> alertFn, std::uint32_t periodMs){
+    show = showStatus;
+    onAlert = alertFn;
+    period = periodMs;
+    queue = nullptr;
+    task = nullptr;
+}
+
+inline void StatusDisplay::start(){
+    if(task != nullptr){
+        return;
+    }
+    queue = pros::c::queue_create(1, sizeof(DriverStatus));
+    task = new pros::Task([this]{ run(); }, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_DEFAULT, "display");
+}
+
+//never blocks, an update the screen hasn't picked up yet is replaced
+inline void StatusDisplay::post(const DriverStatus &status){
+    if(queue == nullptr){
+        return;
+    }
+    if(!pros::c::queue_append(queue, &status, 0)){
+        DriverStatus stale;
+        pros::c::queue_recv(queue, &stale, 0);
+        pros::c::queue_append(queue, &status, 0);
+    }
+}
+
+//handled at the task's next wake, straight away unless it's mid update
+inline void StatusDisplay::alert(std::uint32_t bits){
+    if(task != nullptr){
+        task->notify_ext(bits, pros::E_NOTIFY_ACTION_BITS, nullptr);
+    }
+}
+
+inline void StatusDisplay::run(){
+    while(true){
+        std::uint32_t bits = pros::c::task_notify_take(true, period);
+        if(bits != 0){
+            onAlert(bits);
+        }
+        DriverStatus status;
+        if(pros::c::queue_recv(queue, &status, 0)){
+            show(status);
+        }
+    }
+}
+
+#endif
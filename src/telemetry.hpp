@@ -0,0 +1,150 @@
+#ifndef TELEMETRY_HPP
+#define TELEMETRY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include "main.h"
+#include "pros/apix.h"
+#include "ringbuffer.hpp"
+
+//one control tick as it goes out over the wire, fixed size and packed so the
+//host can read it straight back
+struct __attribute__((packed)) TelemetryRecord{
+    std::uint32_t time;         //ms
+    float x;                    //ft, odometry
+    float y;
+    float theta;                //deg
+    std::int16_t leftVoltage;   //mV commanded, left_drive1
+    std::int16_t rightVoltage;  //mV commanded, right_drive1
+    float leftVelocity;         //rpm
+    float rightVelocity;
+    std::int16_t leftCurrent;   //mA
+    std::int16_t rightCurrent;
+};
+
+//frame kinds, the first byte of every frame
+enum class FrameKind : std::uint8_t{
+    telemetry = 1
+};
+
+//consistent overhead byte stuffing: rewrites length bytes with no zeros so a
+//0 can end each frame, and a reader that joins mid stream resyncs at the next
+//one. out needs length + length / 254 + 1 bytes, returns the bytes written
+inline std::size_t cobsEncode(const std::uint8_t *data, std::size_t length, std::uint8_t *out){
+    std::size_t code = 0;
+    std::size_t write = 1;
+    std::uint8_t run = 1;
+    for(std::size_t i = 0; i < length; i++){
+        if(data[i] == 0){
+            out[code] = run;
+            code = write++;
+            run = 1;
+        }else{
+            out[write++] = data[i];
+            if(++run == 0xFF){
+                out[code] = run;
+                code = write++;
+                run = 1;
+            }
+        }
+    }
+    out[code] = run;
+    return write;
+}
+
+//kind, payload and a checksum that makes the bytes sum to zero, cobs encoded
+//and terminated with the 0 delimiter. payloads are at most 253 bytes, out
+//needs payload + 5 bytes. returns the frame length
+inline std::size_t encodeFrame(FrameKind kind, const void *payload, std::size_t length, std::uint8_t *out){
+    std::uint8_t raw[256];
+    raw[0] = (std::uint8_t)kind;
+    std::uint8_t sum = raw[0];
+    for(std::size_t i = 0; i < length; i++){
+        raw[i + 1] = ((const std::uint8_t*)payload)[i];
+        sum += raw[i + 1];
+    }
+    raw[length + 1] = -sum;
+    std::size_t written = cobsEncode(raw, length + 2, out);
+    out[written] = 0;
+    return written + 1;
+}
+
+//telemetry without putting i/o in the control loops. the sensor task pushes
+//records into a lock-free ring and a task at the lowest priority drains it to
+//a stream in framed batches, whatever it can't keep up with is dropped
+class Telemetry{
+    public:
+        Telemetry();
+        bool push(const TelemetryRecord&);
+        void start(FILE*);
+        std::uint32_t getSent();
+        std::uint32_t getDropped();
+
+    private:
+        static const std::size_t frameSize = sizeof(TelemetryRecord) + 5;
+        static const int batchFrames = 16;
+        void drain();
+
+        RingBuffer<TelemetryRecord, 128> ring;
+        FILE *stream;
+        pros::Task *task;
+        std::atomic<std::uint32_t> sent;   //counted by the drain task, read by anyone
+};
+
+inline Telemetry::Telemetry(){
+    stream = nullptr;
+    task = nullptr;
+    sent = 0;
+}
+
+//never blocks, false if the ring was full
+inline bool Telemetry::push(const TelemetryRecord &record){
+    return task != nullptr && ring.push(record);
+}
+
+//starts draining to the stream. on stdout the kernel's own stream
+//multiplexing is turned off so frames go over usb as they are, text printed
+//elsewhere still goes out between them and the host skips it
+inline void Telemetry::start(FILE *output){
+    if(task != nullptr || output == nullptr){
+        return;
+    }
+    stream = output;
+    if(stream == stdout){
+        pros::c::serctl(SERCTL_DISABLE_COBS, nullptr);
+    }
+    task = new pros::Task([this]{ drain(); }, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_DEFAULT, "telemetry");
+}
+
+inline void Telemetry::drain(){
+    std::uint8_t buffer[frameSize * batchFrames];
+    while(true){
+        std::size_t length = 0;
+        int frames = 0;
+        TelemetryRecord record;
+        while(frames < batchFrames && ring.pop(record)){
+            length += encodeFrame(FrameKind::telemetry, &record, sizeof(record), buffer + length);
+            frames++;
+        }
+        if(frames > 0){
+            fwrite(buffer, 1, length, stream);
+            fflush(stream);
+            sent += frames;
+        }
+        if(frames < batchFrames){
+            pros::delay(20);
+        }
+    }
+}
+
+inline std::uint32_t Telemetry::getSent(){
+    return sent;
+}
+
+inline std::uint32_t Telemetry::getDropped(){
+    return ring.getDropped();
+}
+
+#endif
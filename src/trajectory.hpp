@@ -0,0 +1,168 @@
+#ifndef TRAJECTORY_HPP
+#define TRAJECTORY_HPP
+
+#include <math.h>
+#include <vector>
+#include "motionprofile.hpp"
+#include "odometry.hpp"
+
+//same layout as pathfinder's Segment, but in the Pose frame: feet, and
+//heading in degrees clockwise. position is how far that side has driven
+struct TrajectorySegment{
+    double dt;              //s
+    double x;               //ft
+    double y;
+    double position;        //ft
+    double velocity;        //ft/s
+    double acceleration;    //ft/s^2
+    double jerk;            //ft/s^3
+    double heading;         //deg
+};
+
+//left and right side of a tank trajectory. doesn't own the segments so it
+//can point at constexpr tables as well as generated ones
+struct Trajectory{
+    const TrajectorySegment *left;
+    const TrajectorySegment *right;
+    int length;
+};
+
+//waypoint with the heading the robot should pass through it at
+struct PathPose{
+    double x;       //ft
+    double y;
+    double heading; //deg
+};
+
+//builds a tank trajectory through the poses, one segment every dt seconds.
+//each pair of poses is joined by a cubic hermite spline, the speed along it
+//is limited by the velocity and acceleration limits and slowed on curves so
+//the outside wheel never goes faster than the velocity limit. the jerk limit
+//isn't used, same as pathfinder's tank modifier
+inline void generateTrajectory(const std::vector<PathPose> &poses, ProfileLimits limits, double trackWidth, double dt,
+                               std::vector<TrajectorySegment> &left, std::vector<TrajectorySegment> &right){
+    left.clear();
+    right.clear();
+    if(poses.size() < 2){
+        return;
+    }
+
+    //fine samples along the splines
+    struct Sample{
+        double x, y, heading, curvature;
+        double distance, leftDistance, rightDistance;
+        double velocity, time;
+    };
+    std::vector<Sample> samples;
+    int perSpline = 200;
+    for(std::size_t i = 0; i + 1 < poses.size(); i++){
+        PathPose a = poses[i];
+        PathPose b = poses[i + 1];
+        double scale = 1.2 * hypot(b.x - a.x, b.y - a.y);
+        double ax = scale * cos(a.heading * M_PI / 180);
+        double ay = scale * sin(a.heading * M_PI / 180);
+        double bx = scale * cos(b.heading * M_PI / 180);
+        double by = scale * sin(b.heading * M_PI / 180);
+        for(int j = i == 0 ? 0 : 1; j <= perSpline; j++){
+            double s = (double)j / perSpline;
+            double h00 = 2 * s * s * s - 3 * s * s + 1;
+            double h10 = s * s * s - 2 * s * s + s;
+            double h01 = -2 * s * s * s + 3 * s * s;
+            double h11 = s * s * s - s * s;
+            double dx = (6 * s * s - 6 * s) * a.x + (3 * s * s - 4 * s + 1) * ax + (-6 * s * s + 6 * s) * b.x + (3 * s * s - 2 * s) * bx;
+            double dy = (6 * s * s - 6 * s) * a.y + (3 * s * s - 4 * s + 1) * ay + (-6 * s * s + 6 * s) * b.y + (3 * s * s - 2 * s) * by;
+            double ddx = (12 * s - 6) * a.x + (6 * s - 4) * ax + (-12 * s + 6) * b.x + (6 * s - 2) * bx;
+            double ddy = (12 * s - 6) * a.y + (6 * s - 4) * ay + (-12 * s + 6) * b.y + (6 * s - 2) * by;
+            double speed = hypot(dx, dy);
+
+            Sample sample;
+            sample.x = h00 * a.x + h10 * ax + h01 * b.x + h11 * bx;
+            sample.y = h00 * a.y + h10 * ay + h01 * b.y + h11 * by;
+            sample.heading = atan2(dy, dx) * 180 / M_PI;
+            //positive curvature turns clockwise, toward +y
+            sample.curvature = speed == 0 ? 0 : (dx * ddy - dy * ddx) / (speed * speed * speed);
+            samples.push_back(sample);
+        }
+    }
+
+    //keep the heading continuous so it can be compared against imu rotation
+    samples[0].heading = poses[0].heading;
+    for(std::size_t i = 1; i < samples.size(); i++){
+        samples[i].heading = samples[i - 1].heading + constrainAngle180(samples[i].heading - samples[i - 1].heading);
+    }
+
+    samples[0].distance = 0;
+    samples[0].leftDistance = 0;
+    samples[0].rightDistance = 0;
+    for(std::size_t i = 1; i < samples.size(); i++){
+        double ds = hypot(samples[i].x - samples[i - 1].x, samples[i].y - samples[i - 1].y);
+        double k = (samples[i].curvature + samples[i - 1].curvature) / 2;
+        samples[i].distance = samples[i - 1].distance + ds;
+        samples[i].leftDistance = samples[i - 1].leftDistance + ds * (1 + k * trackWidth / 2);
+        samples[i].rightDistance = samples[i - 1].rightDistance + ds * (1 - k * trackWidth / 2);
+    }
+
+    //fastest speed each sample can have, then forward and backward passes so
+    //the robot can speed up to it and slow down from it in time
+    for(Sample &sample : samples){
+        sample.velocity = limits.velocity / (1 + fabs(sample.curvature) * trackWidth / 2);
+    }
+    samples.front().velocity = 0;
+    samples.back().velocity = 0;
+    for(std::size_t i = 1; i < samples.size(); i++){
+        double ds = samples[i].distance - samples[i - 1].distance;
+        samples[i].velocity = fmin(samples[i].velocity, sqrt(samples[i - 1].velocity * samples[i - 1].velocity + 2 * limits.acceleration * ds));
+    }
+    for(std::size_t i = samples.size() - 1; i-- > 0;){
+        double ds = samples[i + 1].distance - samples[i].distance;
+        samples[i].velocity = fmin(samples[i].velocity, sqrt(samples[i + 1].velocity * samples[i + 1].velocity + 2 * limits.acceleration * ds));
+    }
+
+    samples[0].time = 0;
+    for(std::size_t i = 1; i < samples.size(); i++){
+        double ds = samples[i].distance - samples[i - 1].distance;
+        double average = (samples[i].velocity + samples[i - 1].velocity) / 2;
+        samples[i].time = samples[i - 1].time + (average > 0 ? ds / average : 0);
+    }
+
+    //resample at fixed dt. acceleration is constant between two samples, so
+    //distance is interpolated with it and the rest linearly along distance
+    double duration = samples.back().time;
+    int count = (int)ceil(duration / dt) + 1;
+    std::size_t index = 1;
+    for(int j = 0; j < count; j++){
+        double t = fmin(j * dt, duration);
+        while(index < samples.size() - 1 && samples[index].time < t){
+            index++;
+        }
+        Sample &a = samples[index - 1];
+        Sample &b = samples[index];
+        double ds = b.distance - a.distance;
+        double tau = t - a.time;
+        double acceleration = ds > 0 ? (b.velocity * b.velocity - a.velocity * a.velocity) / (2 * ds) : 0;
+        double f = ds > 0 ? fmin(fmax((a.velocity * tau + acceleration * tau * tau / 2) / ds, 0), 1) : 1;
+        double x = a.x + (b.x - a.x) * f;
+        double y = a.y + (b.y - a.y) * f;
+        double heading = a.heading + (b.heading - a.heading) * f;
+        double curvature = a.curvature + (b.curvature - a.curvature) * f;
+        double velocity = fmax(a.velocity + acceleration * tau, 0);
+        double theta = heading * M_PI / 180;
+
+        TrajectorySegment l = {dt, x + trackWidth / 2 * sin(theta), y - trackWidth / 2 * cos(theta),
+                               a.leftDistance + (b.leftDistance - a.leftDistance) * f,
+                               velocity * (1 + curvature * trackWidth / 2), 0, 0, heading};
+        TrajectorySegment r = {dt, x - trackWidth / 2 * sin(theta), y + trackWidth / 2 * cos(theta),
+                               a.rightDistance + (b.rightDistance - a.rightDistance) * f,
+                               velocity * (1 - curvature * trackWidth / 2), 0, 0, heading};
+        if(j > 0){
+            l.acceleration = (l.velocity - left.back().velocity) / dt;
+            r.acceleration = (r.velocity - right.back().velocity) / dt;
+            l.jerk = (l.acceleration - left.back().acceleration) / dt;
+            r.jerk = (r.acceleration - right.back().acceleration) / dt;
+        }
+        left.push_back(l);
+        right.push_back(r);
+    }
+}
+
+#endif
@@ -1,26 +1,205 @@
+#ifndef UTILITY_HPP
+#define UTILITY_HPP
+
 #include <math.h>
-float PI = 3.141592653589793238;
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+//everything here is a constexpr template so it works on whatever type the
+//caller has, folds away on constants, and is safe to include from more than
+//one source file
+
+inline constexpr double PI = 3.141592653589793238;
 
-float scale(float val, float lowerrange, float upperrange, float lowerscale, float upperscale){
-    float slope = (upperscale - lowerscale)/(upperrange - lowerrange);
+//full scale of pros::Motor::move_voltage(), mV
+inline constexpr int MAX_VOLTAGE = 12000;
+
+//maps val from [lowerrange, upperrange] onto [lowerscale, upperscale], done
+//in double so integer ranges don't truncate the slope
+template <typename V, typename R, typename S>
+constexpr double scale(V val, R lowerrange, R upperrange, S lowerscale, S upperscale){
+    double slope = ((double)upperscale - lowerscale) / ((double)upperrange - lowerrange);
     return val * slope + (lowerscale - slope * lowerrange);
 }
 
-//TODO: may want to add generic types through function templates
-
-int trim(int val, int lower, int upper){
-    return (val > upper ? upper : (val < lower ? lower : val));
+//clamps val to [lower, upper] and keeps val's type
+template <typename T, typename L, typename U>
+constexpr T trim(T val, L lower, U upper){
+    return (val > upper ? (T)upper : (val < lower ? (T)lower : val));
 }
 
-int max(int a, int b){
+template <typename A, typename B>
+constexpr std::common_type_t<A, B> max(A a, B b){
     return (a > b ? a : b);
 }
 
-int min(int a, int b){
+template <typename A, typename B>
+constexpr std::common_type_t<A, B> min(A a, B b){
     return (a > b ? b : a);
 }
 
-float sinusoidal_s_curve(float  width, float height, bool isReversed, float x){
-    bool reverse = isReversed ? 1 : -1;
-    return (reverse * cos(M_PI * x / width) / 2 + 0.5) * height;
+//clamps any integer or floating value into the range of T instead of
+//wrapping, nan becomes 0. negative integers are compared as signed and the
+//rest as unsigned, so every mix of widths and signedness is exact
+template <typename T, typename V>
+constexpr T saturate(V val){
+    static_assert(std::is_integral<T>::value, "saturate() is for integer targets");
+    if constexpr(std::is_floating_point<V>::value){
+        if(val != val){
+            return 0;
+        }
+        if(val >= (V)std::numeric_limits<T>::max()){
+            return std::numeric_limits<T>::max();
+        }
+        if(val <= (V)std::numeric_limits<T>::min()){
+            return std::numeric_limits<T>::min();
+        }
+        return (T)val;
+    }else{
+        if constexpr(std::is_signed<V>::value){
+            if(val < 0){
+                if constexpr(std::is_unsigned<T>::value){
+                    return 0;
+                }else if((std::intmax_t)val < (std::intmax_t)std::numeric_limits<T>::min()){
+                    return std::numeric_limits<T>::min();
+                }
+                return (T)val;
+            }
+        }
+        if((std::uintmax_t)val > (std::uintmax_t)std::numeric_limits<T>::max()){
+            return std::numeric_limits<T>::max();
+        }
+        return (T)val;
+    }
+}
+
+//integer math that sticks at the limits of T instead of overflowing. the
+//exact result is worked out in 64 bits, so T has to be narrower than that,
+//and no wider than 31 bits for a product
+template <typename T>
+constexpr T saturatingAdd(T a, T b){
+    static_assert(std::numeric_limits<T>::digits < 63, "saturatingAdd() needs T under 64 bits");
+    return saturate<T>((std::int64_t)a + b);
+}
+
+template <typename T>
+constexpr T saturatingSub(T a, T b){
+    static_assert(std::numeric_limits<T>::digits < 63, "saturatingSub() needs T under 64 bits");
+    return saturate<T>((std::int64_t)a - b);
 }
+
+template <typename T>
+constexpr T saturatingMul(T a, T b){
+    static_assert(std::numeric_limits<T>::digits <= 31, "saturatingMul() needs T of 31 bits or less");
+    return saturate<T>((std::int64_t)a * b);
+}
+
+//signed fixed point with Bits fraction bits stored in Base, for loops that
+//want fractional gains without going through the fpu. products and quotients
+//use a 64 bit intermediate and saturate instead of wrapping, so Base is at
+//most 32 bits. dividing by zero saturates toward the dividend's sign
+template <int Bits, typename Base = std::int32_t>
+class Fixed{
+    static_assert(std::is_signed<Base>::value && std::numeric_limits<Base>::digits <= 31,
+                  "Fixed needs a signed Base of 32 bits or less");
+    static_assert(Bits > 0 && Bits < std::numeric_limits<Base>::digits, "Fixed needs an integer bit");
+
+    public:
+        static constexpr Base one = (Base)1 << Bits;
+
+        constexpr Fixed() : raw(0){}
+
+        static constexpr Fixed fromRaw(Base value){
+            Fixed f;
+            f.raw = value;
+            return f;
+        }
+
+        template <typename T>
+        static constexpr Fixed from(T value){
+            return fromRaw(saturate<Base>(value * (double)one + (value < 0 ? -0.5 : 0.5)));
+        }
+
+        constexpr Base getRaw() const{
+            return raw;
+        }
+
+        constexpr double toDouble() const{
+            return (double)raw / one;
+        }
+
+        //rounds toward zero like an int cast
+        constexpr Base toInt() const{
+            return raw / one;
+        }
+
+        constexpr Fixed operator+(Fixed other) const{
+            return fromRaw(saturatingAdd<Base>(raw, other.raw));
+        }
+
+        constexpr Fixed operator-(Fixed other) const{
+            return fromRaw(saturatingSub<Base>(raw, other.raw));
+        }
+
+        constexpr Fixed operator-() const{
+            return fromRaw(saturate<Base>(-(std::int64_t)raw));
+        }
+
+        constexpr Fixed operator*(Fixed other) const{
+            return fromRaw(saturate<Base>(((std::int64_t)raw * other.raw) >> Bits));
+        }
+
+        constexpr Fixed operator/(Fixed other) const{
+            if(other.raw == 0){
+                return fromRaw(raw == 0 ? 0 : raw > 0 ? std::numeric_limits<Base>::max() : std::numeric_limits<Base>::min());
+            }
+            return fromRaw(saturate<Base>((std::int64_t)raw * one / other.raw));
+        }
+
+        constexpr bool operator<(Fixed other) const{
+            return raw < other.raw;
+        }
+
+        constexpr bool operator>(Fixed other) const{
+            return raw > other.raw;
+        }
+
+        constexpr bool operator==(Fixed other) const{
+            return raw == other.raw;
+        }
+
+        constexpr bool operator!=(Fixed other) const{
+            return raw != other.raw;
+        }
+
+    private:
+        Base raw;
+};
+
+//half cosine ramp over [0, width]: rises from 0 to height, or falls from
+//height to 0 when reversed
+template <typename T>
+inline T sinusoidal_s_curve(T width, T height, bool isReversed, T x){
+    int reverse = isReversed ? 1 : -1;
+    return (reverse * cos(PI * x / width) / 2 + 0.5) * height;
+}
+
+//the edges of the above, checked by the compiler wherever this is included
+static_assert(saturate<std::int8_t>(300) == 127 && saturate<std::int8_t>(-300) == -128);
+static_assert(saturate<std::uint64_t>(-1) == 0 && saturate<std::uint8_t>(std::numeric_limits<std::int64_t>::min()) == 0);
+static_assert(saturate<std::int64_t>(std::numeric_limits<std::uint64_t>::max()) == std::numeric_limits<std::int64_t>::max());
+static_assert(saturate<std::uint32_t>(std::numeric_limits<std::uint64_t>::max()) == std::numeric_limits<std::uint32_t>::max());
+static_assert(saturate<std::int32_t>(1e20) == std::numeric_limits<std::int32_t>::max() && saturate<std::int32_t>(-1e20) == std::numeric_limits<std::int32_t>::min());
+static_assert(saturatingAdd<std::int32_t>(std::numeric_limits<std::int32_t>::max(), 1) == std::numeric_limits<std::int32_t>::max());
+static_assert(saturatingSub<std::uint32_t>(0, 1) == 0);
+static_assert(saturatingMul<std::int32_t>(std::numeric_limits<std::int32_t>::min(), -1) == std::numeric_limits<std::int32_t>::max());
+static_assert(saturatingMul<std::int16_t>(-300, 300) == std::numeric_limits<std::int16_t>::min());
+static_assert((Fixed<16>::from(1) / Fixed<16>()).getRaw() == std::numeric_limits<std::int32_t>::max());
+static_assert((Fixed<16>::from(-1) / Fixed<16>()).getRaw() == std::numeric_limits<std::int32_t>::min());
+static_assert((Fixed<16>() / Fixed<16>()).getRaw() == 0);
+static_assert((Fixed<16>::from(-3) / Fixed<16>::from(2)).toDouble() == -1.5);
+static_assert((Fixed<16>::from(30000) * Fixed<16>::from(30000)).getRaw() == std::numeric_limits<std::int32_t>::max());
+static_assert(Fixed<16>::from(1e12).getRaw() == std::numeric_limits<std::int32_t>::max());
+
+#endif